@@ -0,0 +1,234 @@
+/**
+ * \file main.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Compression Report, How Far the Taylor Coefficients are From the Exact Delays and How Fast They are Made and Undone
+ * \version 0.1
+ * \date 2022-05-14
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include <cmath>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <string>
+
+#include "Controller.hpp"
+#include "Kernels.hpp"
+#include "SIMD.hpp"
+#include "Benchmark.hpp"
+
+#include "fmt/format.h"
+
+using SoundCath::ControllerParams;
+using SoundCath::TransducerParams;
+using SoundCath::TXController;
+using SoundCath::RXController;
+using SoundCath::TaylorKernel;
+using SoundCath::FocalPoint;
+using SoundCath::TxDelayKernel;
+using SoundCath::MakeFoci;
+using SoundCath::TimeCompression;
+using SoundCath::QuantDelays;
+using SoundCath::QuantPhases;
+using SoundCath::TxCoeffs;
+using SoundCath::RxCoeffs;
+
+/// Tx Delays Further Than This From the Exact Ones are the ASIC's Out of Range Marker, not an Error
+constexpr double OUT_OF_RANGE_UNITS = TaylorKernel::TX_INVALID / 2.0;
+
+/// Running Max and RMS of the Delay Error
+struct ErrorStats {
+
+    double max_ns{0.0};         ///< Largest Error in ns
+    double sumsq{0.0};          ///< Sum of the Squared Errors
+    size_t count{0};            ///< Elements Counted
+    size_t outofrange{0};       ///< Elements the ASIC Marked Out of Range, Not Counted
+
+    /**
+     * \brief Counts an Element
+     *
+     * \param[in] error_ns: How Far it is Off in ns
+     */
+    void Add(const double error_ns) noexcept {
+
+        max_ns = std::max(max_ns, std::abs(error_ns));
+        sumsq += error_ns * error_ns;
+        count++;
+
+    }
+
+    /**
+     * \brief Adds Another Set of Stats to These
+     *
+     * \param[in] other: The Stats to Add
+     */
+    void Merge(const ErrorStats& other) noexcept {
+
+        max_ns = std::max(max_ns, other.max_ns);
+        sumsq += other.sumsq;
+        count += other.count;
+        outofrange += other.outofrange;
+
+    }
+
+    /**
+     * \brief Get the RMS Error
+     *
+     * \return double: RMS Error in ns
+     */
+    double GetRMS() const noexcept { return count ? std::sqrt(sumsq / count) : 0.0; }
+
+};
+
+/**
+ * \brief Works Out Where Every Element is, in the ASIC's Element Order the Decompression Uses
+ *
+ * \tparam usparams: The Transducer Pitches
+ * \param[out] x: X of Every Element in Meters
+ * \param[out] y: Y of Every Element in Meters
+ */
+template<TransducerParams usparams>
+void ElementPositions(std::array<double, 1024>& x, std::array<double, 1024>& y) noexcept {
+
+    const double pitch = usparams.pitch_nm * 1e-9;
+    const double gpitch = usparams.group_pitch_nm * 1e-9;
+
+    for(int gy = 0; gy < TaylorKernel::GROUPS_Y; gy++)
+        for(int gx = 0; gx < TaylorKernel::GROUPS_X; gx++)
+            for(int e = 0; e < 16; e++) {
+
+                const size_t i = (gy * TaylorKernel::GROUPS_X + gx) * 16 + e;
+                x[i] = (gx - (TaylorKernel::GROUPS_X - 1) / 2.0) * gpitch + (e / 4 - 1.5) * pitch;
+                y[i] = (gy - (TaylorKernel::GROUPS_Y - 1) / 2.0) * gpitch + (e % 4 - 1.5) * pitch;
+
+            }
+}
+
+/**
+ * \brief Compares Decompressed Delays With the Exact Ones, the Best Constant Offset is Taken Off First so Only the Shape Counts
+ *
+ * \param[in] delays: The Decompressed Delays in Delay Res Units
+ * \param[in] exact_ns: The Exact Delays in ns
+ * \param[in] res_ns: The Delay Resolution in ns
+ * \param[in] first: First Element to Compare
+ * \param[in] count: How Many Elements to Compare
+ * \param[in,out] stats: Where the Errors Go
+ */
+void Compare(const QuantDelays& delays, const std::array<double, 1024>& exact_ns, const double res_ns, const size_t first, const size_t count, ErrorStats& stats) {
+
+    std::array<double, 1024> diff;
+    for(size_t i = 0; i < count; i++)
+        diff[i] = delays[first + i] * res_ns - exact_ns[first + i];
+
+    // the median, so the out of range markers don't drag the offset
+    std::array<double, 1024> sorted = diff;
+    std::nth_element(sorted.begin(), sorted.begin() + count / 2, sorted.begin() + count);
+    const double offset = sorted[count / 2];
+
+    for(size_t i = 0; i < count; i++) {
+
+        if(std::abs(diff[i] - offset) > OUT_OF_RANGE_UNITS * res_ns)
+            stats.outofrange++;
+        else
+            stats.Add(diff[i] - offset);
+
+    }
+}
+
+/**
+ * \brief Sweeps the Scan Grid at Each Depth and Prints the Compression Error, Then Times Compression and Decompression
+ *
+ * Tx is Compared Over the Whole Aperture. Rx is Compared per Group, the Delays Between Groups are Done by the FPGA, so
+ * Only the Delays Inside a Group Come From the Coefficients.
+ *
+ * \tparam params: The Controller Params, Holds the Scan Grid, the Depth Range and the Lookup Table Factors
+ * \tparam usparams: The Transducer
+ * \param[in] depths: How Many Depths to Sweep Between the Min and Max Depth
+ */
+template<ControllerParams params, TransducerParams usparams>
+void Report(const uint32_t depths) {
+
+    std::array<double, 1024> elx, ely;
+    ElementPositions<usparams>(elx, ely);
+
+    const double txres = params.txparams.delay_res_ns;
+    const double rxres = params.rxparams.delay_res_ns;
+
+    std::vector<FocalPoint> foci;
+    ErrorStats txtotal, rxtotal;
+
+    fmt::print("Taylor Compression Error, {} x {} Beams per Depth, Tx Res {} ns, Rx Res {} ns\n", params.x_steps, params.y_steps, txres, rxres);
+    fmt::print("{:>10} {:>12} {:>12} {:>12} {:>12} {:>12}\n", "Depth mm", "Tx Max ns", "Tx RMS ns", "Rx Max ns", "Rx RMS ns", "Tx Out");
+
+    for(uint32_t d = 0; d < depths; d++) {
+
+        const double depth = (params.z_min_mm + (params.z_max_mm - params.z_min_mm) * d / std::max(depths - 1, 1u)) * 1e-3;
+        ErrorStats txstats, rxstats;
+
+        for(const FocalPoint& focus: MakeFoci(params, depth)) { // same beam directions as the scan data
+
+            foci.push_back(focus);
+
+            const double r = std::sqrt(focus.x * focus.x + focus.y * focus.y + focus.z * focus.z);
+            std::array<double, 1024> exact;
+            for(size_t e = 0; e < exact.size(); e++)
+                exact[e] = (r - std::sqrt(std::pow(focus.x - elx[e], 2) + std::pow(focus.y - ely[e], 2) + focus.z * focus.z)) / usparams.soundspeed * 1e9;
+
+            QuantDelays delays;
+            QuantPhases phases;
+
+            TaylorKernel::UncompressTx(TXController<params.txparams, usparams>::CompressTaylor(focus.x, focus.y, focus.z, 0).coeffs, delays);
+            Compare(delays, exact, txres, 0, delays.size(), txstats);
+
+            TaylorKernel::UncompressRx(RXController<params.rxparams, usparams>::CompressTaylor(focus.x, focus.y, focus.z), delays, phases);
+            for(size_t g = 0; g < delays.size(); g += 16)
+                Compare(delays, exact, rxres, g, 16, rxstats);
+
+        }
+
+        fmt::print("{:>10.1f} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f} {:>12}\n", depth * 1e3, txstats.max_ns, txstats.GetRMS(), rxstats.max_ns, rxstats.GetRMS(), txstats.outofrange);
+        txtotal.Merge(txstats);
+        rxtotal.Merge(rxstats);
+
+    }
+
+    fmt::print("{:>10} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f} {:>12}\n\n", "All", txtotal.max_ns, txtotal.GetRMS(), rxtotal.max_ns, rxtotal.GetRMS(), txtotal.outofrange);
+
+    // throughput, one thread, over the same beams
+    QuantDelays delays;
+    QuantPhases phases;
+
+    const auto tx = TimeCompression(foci,
+        [](const FocalPoint& focus) { return TXController<params.txparams, usparams>::CompressTaylor(focus.x, focus.y, focus.z, 0).coeffs; },
+        [&](const TxCoeffs& coeffs, const size_t i) { TaylorKernel::UncompressTx(coeffs, delays); return delays[i % delays.size()]; });
+
+    const auto rx = TimeCompression(foci,
+        [](const FocalPoint& focus) { return RXController<params.rxparams, usparams>::CompressTaylor(focus.x, focus.y, focus.z); },
+        [&](const RxCoeffs& coeffs, const size_t i) { TaylorKernel::UncompressRx(coeffs, delays, phases); return delays[i % delays.size()]; });
+
+    fmt::print("Throughput Over {} Beams, One Thread, {} Kernels\n", foci.size(), SoundCath::SIMD::GetISA());
+    fmt::print("{:>14} {:>16} {:>16}\n", "", "Compress Beam/s", "Decompress Beam/s");
+    fmt::print("{:>14} {:>16.0f} {:>16.0f}\n", "Tx", tx.compress, tx.decompress);
+    fmt::print("{:>14} {:>16.0f} {:>16.0f}\n", "Rx", rx.compress, rx.decompress);
+    fmt::print("({})\n", tx.sink + rx.sink); // keeps the decompression from being thrown away
+
+}
+
+/**
+ * \brief Runs the Report on the Default Parameters
+ *
+ * \param argc: The Number of Arguments
+ * \param kwargs: The Arguments, the First is How Many Depths to Sweep, 8 if Not Given
+ * \return int: The exit status code
+ */
+int main(const int argc, const char* const* const kwargs) {
+
+    const uint32_t depths = argc > 1 ? uint32_t(std::max(std::stoi(kwargs[1]), 1)) : 8;
+
+    Report<ControllerParams{}, TransducerParams{}>(depths);
+    return 0;
+
+}
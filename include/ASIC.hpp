@@ -16,6 +16,8 @@
 #include <string>
 #include <iostream>
 #include <array>
+#include <vector>
+
 namespace SoundCath {
 
 /// Delay Values for a Group
@@ -28,7 +30,6 @@ typedef GroupDelays GroupPhases;
  * \throws ios_base::failure: If the Data Can't be Formatted
  * \param[out] os: The Output Stream To Send the Formatted Data To 
  * \param[in] rx: The Delays to Parse and Send
- * \todo Implement this
  * \return std::ostream&:  A Modified output stream 
  */
 std::ostream& operator<<(std::ostream& os, const GroupDelays& rx);
@@ -38,10 +39,19 @@ typedef std::array<double, 16 * 64> Delays;
 /// Phases for Dynamic Curves
 typedef Delays Phases;
 
+/// Tx Delays Rounded to Whole Delay Units, What the ASIC Actually Gets (0 - 510)
+typedef std::array<int16_t, 16 * 64> QuantDelays;
+
+/// Rx Delays Rounded to Whole Delay Units (-1 - 31)
+typedef std::array<int8_t, 16 * 64> QuantRxDelays;
+
+/// Which of the 8 Dynamic Rx Curves Each Element Follows (0 - 7)
+typedef std::array<int8_t, 16 * 64> QuantPhases;
+
 /**
  * \brief Prints A Delay to a Stream
  * \throws ios_base::failure: If there is an Issue Reading the Value
- * \todo Implement this
+ * \note Delays are Rounded to the Nearest Integer Delay Unit, see \ref FormatDelays
  * \param[out] os: Output Stream, Could be a string stream, cout, etc..
  * \param[in] rx: Delay to write to the stream
  * \return std::ostream&: A Modified Stream Reference for chaining
@@ -50,8 +60,8 @@ std::ostream& operator<<(std::ostream& os, const Delays& delays);
 
 /**
  * \brief Gets a Delay String and Turns It into an Actual Delay Object
+ * \note Reads One Comma Separated List With No Spaces, Sets the failbit if it isn't 1024 Integers
  * \throws ios_base::failure: If it can't resolve the Delay String
- * \todo Implement this
  * \param[in] is: Input Stream to Get the String from 
  * \param[out] delays: Actual Delay Object to Write to
  * \return std::istream&: A modified input strema reference
@@ -114,10 +124,16 @@ struct ASICError {
     void ThrowErrors(const Code error) const;
 };
 
+struct DeviceStatus; // in Status.hpp, it needs the FPGA's codes too
 
 /**
  * \brief Controls and  Manages the ASIC
  * 
+ * The Try Calls Return the \ref DriverResult of the Command, Which Only Has the Driver's Mask. The DLL Reports the
+ * ASIC's Own Flags, BUSY, VALID_ERROR and so on, Only Through a Separate GetAsicError Query, so a Failed Try Call Just
+ * Has \ref DriverError::ASICERROR Set and \ref GetError Fetches the Flags Behind it. That Costs a Round Trip, so it is
+ * Left to the Caller and Only Done After a Failure, \ref Scheduler Does it to Decide What to Retry.
+ * 
  * \todo Finish Implementation According to the Spec and test Everything
  * 
  * \tparam params: Physical parameters of the ASIC and the environment
@@ -132,15 +148,30 @@ public:
      * 
      * \param[in] driver: Reference to an Interface to Talk to the ASIC With 
      */
-    ASIC(Driver& driver);
+    ASIC(Driver& driver): ASIC(driver, params.speed) {}
 
     /**
-     * \brief Get the Error Code From the last Operation
+     * \brief Construct a new ASIC object at a Clock Speed Picked at Runtime, Instead of the One in the Params
      * 
+     * \param[in] driver: Reference to an Interface to Talk to the ASIC With 
+     * \param[in] speed: The Clock Speed to Initialize the ASIC at
+     */
+    ASIC(Driver& driver, const ASICParams::ClkSpeed speed);
+
+    /**
+     * \brief Get the Error Code From the last Operation, the Flags Behind a \ref DriverError::ASICERROR
+     * \throws DriverException: If the Status Can't be Read
      * \return ASICError: The Error Code of the Last Operation
      */
     ASICError::Code GetError() const;
 
+    /**
+     * \brief Get the ASIC and FPGA Status in One Query, See \ref DeviceStatus in Status.hpp
+     * \throws DriverException: If the Query Fails or the Response is Malformed
+     * \return DeviceStatus: The Error Codes of Both
+     */
+    DeviceStatus GetStatus() const;
+
     // ------------------------- Fire Commands ---------------------- //
 
     /**
@@ -150,6 +181,13 @@ public:
      */
     void Fire(const Delays& delays);
 
+    /**
+     * \brief Same as \ref Fire but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFire(const Delays& delays);
+
     /**
      * \brief Fires the Whole ASIC and Receives to a Group
      * 
@@ -159,6 +197,13 @@ public:
      */
     void Fire(const Group group, const Delays& tx, const GroupDelays& rx);
 
+    /**
+     * \brief Same as \ref Fire but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFire(const Group group, const Delays& tx, const GroupDelays& rx);
+
     /**
      * \brief Fires a Single Element
      * 
@@ -166,6 +211,13 @@ public:
      */
     void Fire(const Element elem);
 
+    /**
+     * \brief Same as \ref Fire but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFire(const Element elem);
+
     /**
      * \brief 
      * 
@@ -187,6 +239,13 @@ public:
      */
     void FireGroup(const Group group, const GroupDelays& tx);
 
+    /**
+     * \brief Same as \ref FireGroup but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFireGroup(const Group group, const GroupDelays& tx);
+
     /**
      * \brief Fire a Group with Tx Delays and Receive from the Same Group with the RX Delays
      * \throws ASICException: If there is an Issue with the ASIC
@@ -197,6 +256,13 @@ public:
      */
     void FireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx);
 
+    /**
+     * \brief Same as \ref FireGroup but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx);
+
     /**
      * \brief Fire From a Group and Receive from a Different group
      * \throws ASICException: If there is an Issue with the ASIC
@@ -208,6 +274,13 @@ public:
      */
     void FireGroup(const Group txgroup, const GroupDelays& tx, const GroupDelays& rx, const Group rxgroup);
 
+    /**
+     * \brief Same as \ref FireGroup but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFireGroup(const Group txgroup, const GroupDelays& tx, const GroupDelays& rx, const Group rxgroup);
+
     /**
      * \brief Fire a Group and receive With a Dynamic Phase Rx
      * \note Phase Curves must be set before running
@@ -220,6 +293,13 @@ public:
      */
     void FireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx, const GroupPhases& rxphases);
 
+    /**
+     * \brief Same as \ref FireGroup but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx, const GroupPhases& rxphases);
+
     // ----------------------- Recieving Commands ---------------------- //
 
     /**
@@ -238,6 +318,15 @@ public:
      */
     void ReadRXDelays(Delays& delays);
 
+    /**
+     * \brief Read the last Reception Delays and Their Clock Phases
+     * \throws ASICException: If there is an Issue with the ASIC
+     * \throws DriverException: If there are any Issues at all on the backend
+     * \param[out] delays: Delays received
+     * \param[out] phases: Clock Phases of the Delays
+     */
+    void ReadRXDelays(Delays& delays, Phases& phases);
+
     /**
      * \brief Read the Last Received Reception Taylor Coefficients 
      * \throws ASICException: If there is an Issue with the ASIC
@@ -273,6 +362,13 @@ public:
      */
     void QueueBeam(const TxCoeffs& tx, const RxCoeffs& rx);
 
+    /**
+     * \brief Same as \ref QueueBeam but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryQueueBeam(const TxCoeffs& tx, const RxCoeffs& rx);
+
     /**
      * \brief Add a Beam to The Beam Queue with Delays Rather than Taylor Coefficients
      * \throws ASICException: If there is an Issue with the ASIC
@@ -282,6 +378,29 @@ public:
      */
     void QueueBeam(const Delays& tx, const Delays& rx);
 
+    /**
+     * \brief Same as \ref QueueBeam but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryQueueBeam(const Delays& tx, const Delays& rx);
+
+    /**
+     * \brief Add a Beam to The Beam Queue with Quantized Delays, What \ref ScanData Stores in Delay Mode
+     * \throws ASICException: If there is an Issue with the ASIC
+     * \throws DriverException: If there are any Issues at all on the backend
+     * \param[in] tx: Transmission Delays
+     * \param[in] rx: Reception Delays
+     */
+    void QueueBeam(const QuantDelays& tx, const QuantRxDelays& rx);
+
+    /**
+     * \brief Same as \ref QueueBeam but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryQueueBeam(const QuantDelays& tx, const QuantRxDelays& rx);
+
     /**
      * \brief Send a Copy of the Last Sent Beam to the Top of the Queue in the FPGA
      * \throws ASICException: If there is an Issue with the ASIC
@@ -289,6 +408,13 @@ public:
      */
     void QueueRepeatBeam();
 
+    /**
+     * \brief Same as \ref QueueRepeatBeam but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryQueueRepeatBeam();
+
     /**
      * \brief Send the Beam Queue To the ASIC
      * \throws ASICException: If there is an Issue with the ASIC
@@ -296,6 +422,13 @@ public:
      */
     void FlushBeamQueue();
 
+    /**
+     * \brief Same as \ref FlushBeamQueue but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryFlushBeamQueue();
+
     /**
      * \brief Get the Number of Beams in the Beam Queue in the FPGA
      * \throws ASICException: If there is an Issue with the ASIC
@@ -311,6 +444,13 @@ public:
      */
     void ClearBeamQueue();
 
+    /**
+     * \brief Same as \ref ClearBeamQueue but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryClearBeamQueue();
+
     /**
      * \brief Send a Beam to Be Fired 
      * \throws ASICException: If there is an Issue with the ASIC
@@ -319,6 +459,13 @@ public:
      */
     void TriggerBeam(const uint8_t beaminqueue);
 
+    /**
+     * \brief Same as \ref TriggerBeam but Returns the Error Mask Instead of Throwing, for Retrying a Busy ASIC
+     * \throws DriverException: Only if the Command Doesn't Fit the Command Buffer
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TryTriggerBeam(const uint8_t beaminqueue);
+
     /**
      * \brief Enter a Low Power State For A while, any command wakes it up
      * \throws ASICException: If there is an Issue with the ASIC
@@ -386,17 +533,33 @@ public:
      */
     bool RunTests() const;
 
+    /// Size of the Command Buffer, the Biggest Command (Queueing 3 Full Arrays of Delays) is About 12kB
+    static constexpr size_t COMMAND_SIZE = UINT16_MAX;
+
 private:
 
     /**
-     * \brief 
+     * \brief Initializes the ASIC at a Clock Speed
      * 
+     * \param[in] speed: The Clock Speed
      */
-    void InitializeASIC() const;
+    void InitializeASIC(const ASICParams::ClkSpeed speed) const;
+
+    /**
+     * \brief Formats a Command Into the Command Buffer, Replaces Whatever Was There
+     * \throws DriverException: If the Command Doesn't Fit in the Buffer
+     * \param[in] format: Compiled Format String for the Command
+     * \param[in] args: What to Format
+     * \return const char*: The Null Terminated Command, Valid Until the Next Encode
+     */
+    template<typename Format, typename... Args>
+    const char* Encode(const Format& format, const Args&... args) const;
 
     SoundCath::Driver& driver;      ///< An Instance of the wrapper for the Oldelft API
     std::string serialnum;          ///< The Serial Number
 
+    mutable std::array<char, COMMAND_SIZE> command;    ///< Commands are Formatted Here so Nothing is Allocated Per Beam
+
 };
 
 
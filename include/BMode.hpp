@@ -0,0 +1,137 @@
+/**
+ * \file BMode.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the B-Mode Stage, Turns Beamformed RF Lines Into Pixels
+ * \version 0.1
+ * \date 2022-05-27
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Beamformer.hpp"
+#include "Parameters.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace SoundCath {
+
+/**
+ * \brief Turns Beamformed RF Lines Into B-Mode Pixels: Bandpass Filter, Envelope Detection and Log Compression
+ *
+ * The Bandpass and the Hilbert Transform are One Complex FIR Filter, a Hann Windowed Lowpass Shifted up to the Center
+ * Frequency, so a Line is Filtered Into its In Phase and Quadrature Parts in One Pass and the Envelope is Their
+ * Magnitude. The Power is Log Compressed Straight to 8 Bit Pixels With a Fast log2 Good to a Few Hundredths of a dB,
+ * Well Under the Step Between Two Pixel Values, Without a Square Root.
+ *
+ * Every Line is Processed on its Own With Zeros Past its Ends and Nothing is Kept Between Calls, so Blocks of Lines
+ * can be Processed as They Arrive, in Any Order and on Any Thread. The Filter is Written With \ref SIMD, the Log
+ * Compression is Left to the Compiler to Vectorize.
+ */
+class BMode {
+
+public:
+
+    /// How to Filter and Compress
+    struct Config {
+
+        double samplerate_hz{40e6};     ///< Sample Rate of the Lines
+        double freq_cent_mhz{5.0};      ///< Center of the Passband
+        double bandwidth{.6};           ///< Width of the Passband as a Fraction of the Center Frequency
+        size_t taps{31};                ///< Length of the Filter, Made Odd so it has a Middle
+        float dbrange{40.0f};           ///< Range Shown, an Envelope This Far Under the Reference is Black
+        float reference{1.0f};          ///< The Envelope Shown as White
+
+    };
+
+    /**
+     * \brief Construct a new BMode object, Designs the Filter
+     *
+     * \param[in] config: How to Filter and Compress
+     */
+    explicit BMode(const Config& config);
+
+    /**
+     * \brief Construct a new BMode object From the Parameters, the Center Frequency and the dB Range Come From Them
+     *
+     * \param[in] params: The Parameters, \ref USParams::freq_cent_mhz and \ref ASICParams::BModeSettings::dbrange are Used
+     * \param[in] samplerate_hz: Sample Rate of the Lines
+     */
+    BMode(const USParams& params, const double samplerate_hz);
+
+    /**
+     * \brief Get the In Phase Taps of the Filter, Scaled so a Tone at the Center Frequency Comes Out at its Amplitude
+     *
+     * \return const std::vector<float>&: The Taps
+     */
+    const std::vector<float>& GetInPhase() const noexcept { return inphase; }
+
+    /**
+     * \brief Get the Quadrature Taps of the Filter
+     *
+     * \return const std::vector<float>&: The Taps
+     */
+    const std::vector<float>& GetQuadrature() const noexcept { return quadrature; }
+
+    /**
+     * \brief Detects the Envelope of a Line, Mostly to Look at, \ref ProcessLine Goes Straight to Pixels
+     *
+     * \param[in] rf: The Line
+     * \param[in] samples: Samples in the Line
+     * \param[out] envelope: The Envelope, as Many Samples as the Line
+     */
+    void Envelope(const float* rf, const size_t samples, float* envelope) const;
+
+    /**
+     * \brief Turns a Line Into Pixels
+     *
+     * \param[in] rf: The Line
+     * \param[in] samples: Samples in the Line
+     * \param[out] pixels: One Pixel per Sample, 0 is \ref Config::dbrange Under the Reference or Less, 255 the Reference or More
+     */
+    void ProcessLine(const float* rf, const size_t samples, uint8_t* pixels) const;
+
+    /**
+     * \brief Turns a Block of Lines Into Pixels, the Lines are Spread Over a Thread Pool
+     *
+     * \param[in] lines: The Lines, Back to Back
+     * \param[in] count: Number of Lines
+     * \param[in] samples: Samples per Line
+     * \param[out] pixels: The Pixels, Laid Out Like the Lines
+     * \param[in] pool: Threads to Process the Lines on
+     */
+    void Process(const float* lines, const size_t count, const size_t samples, uint8_t* pixels, ThreadPool& pool) const;
+
+    /**
+     * \brief Turns Beamformed Lines Into Pixels, the Lines are Spread Over a Thread Pool
+     *
+     * \param[in] frame: The Lines
+     * \param[out] pixels: The Pixels, Laid Out Like the Lines, Resized to Fit
+     * \param[in] pool: Threads to Process the Lines on
+     */
+    void Process(const BeamformedFrame& frame, std::vector<uint8_t>& pixels, ThreadPool& pool) const;
+
+private:
+
+    /**
+     * \brief Filters a Line Into its In Phase and Quadrature Parts
+     *
+     * \param[in] rf: The Line
+     * \param[in] samples: Samples in the Line
+     * \param[out] i: The In Phase Part
+     * \param[out] q: The Quadrature Part
+     */
+    void Filter(const float* rf, const size_t samples, float* i, float* q) const;
+
+    std::vector<float> inphase;     ///< Real Taps of the Filter
+    std::vector<float> quadrature;  ///< Imaginary Taps of the Filter
+    float gain;                     ///< Pixels per log2 of Power
+    float offset;                   ///< Pixel Value at a Power of 1
+
+};
+
+}
@@ -0,0 +1,343 @@
+/**
+ * \file BeamQueue.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Beam Queue Manager, Streams Whole Frames Through the FPGA B-Mode Queue
+ * \version 0.1
+ * \date 2022-05-08
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "ASIC.hpp"
+#include "Controller.hpp"
+#include "Scheduler.hpp"
+#include "Exception.hpp"
+#include "Logging.hpp"
+
+#include <cstdint>
+#include <algorithm>
+
+#include <fmt/format.h>
+
+namespace SoundCath {
+
+/**
+ * \brief Streams Frames of \ref ScanData Through the FPGA B-Mode Queue
+ *
+ * The FPGA Queue is Split Into Two Banks of Half the Capacity Each. A Frame is Cut Into Bank Sized Chunks, and While
+ * Chunk N is Being Triggered the Beams of Chunk N + 1 are Staged Between the Triggers, so the Link is Busy Transferring
+ * the Next Chunk While the Hardware Fires. Chunk N + 1 is Uploaded Into the Other Bank as Soon as Chunk N is Done.
+ * Once Both Banks are Used the Queue has to be Cleared, and Clearing Drops Beams Staged on the Host too, so the Chunk
+ * After That is Staged Once the Last Bank has Fired and the Queue is Cleared, Without the Overlap.
+ *
+ * Occupancy is Tracked Locally, the Queue is Only Read Back With \ref Sync. A Frame That Fits in the Queue Stays
+ * Resident, so Firing it Again With the Same Id Only Sends Triggers.
+ *
+ * Given a \ref Scheduler the Queue Commands Go Through it, a Busy ASIC or a Full FPGA Queue Slows the Stream Down
+ * Instead of Failing the Frame.
+ *
+ * \tparam aparams: The ASIC Params of the ASIC to Fire With
+ * \tparam params: The Controller Params the Frames Were Calculated With
+ * \tparam usparams: The Transducer the Frames Were Calculated For
+ */
+template<ASICParams aparams, ControllerParams params, TransducerParams usparams>
+class BeamQueueManager {
+
+public:
+
+    /// How Many Entries the FPGA Queue Holds if Nothing Else is Given, Also the Most a Trigger can Address
+    static constexpr uint32_t DEFAULT_CAPACITY = 256;
+
+    /// Number of Beams in a Frame
+    static constexpr uint32_t FRAME_SIZE = params.x_steps * params.y_steps;
+
+    /**
+     * \brief Construct a new Beam Queue Manager object, Clears the FPGA Queue so the Local Count Starts Right
+     * \throws ConfigException: If the Capacity is Under 2 or Over 256, the Entries a Trigger can Address
+     * \throws ASICException: If there is an Issue with the ASIC
+     * \throws DriverException: If there are any Issues at all on the backend
+     * \param[in] asic: The ASIC to Queue and Fire Beams With
+     * \param[in] capacity: Entries in the FPGA Queue, 2 to 256
+     * \param[in] scheduler: Retries Commands While the Box is Busy, nullptr to Fail Right Away
+     */
+    BeamQueueManager(ASIC<aparams>& asic, const uint32_t capacity = DEFAULT_CAPACITY, Scheduler* scheduler = nullptr):
+        asic(asic), bank(capacity / 2), scheduler(scheduler) {
+
+        if(capacity < 2 || capacity > DEFAULT_CAPACITY)
+            throw ConfigException(fmt::format("A B-Mode Queue of {} Entries Isn't Supported, Triggers Address 2 to {}", capacity, DEFAULT_CAPACITY));
+
+        Reset();
+
+    }
+
+    /**
+     * \brief Fires Every Beam in a Frame, in Order
+     * \throws ASICException: If there is an Issue with the ASIC
+     * \throws DriverException: If there are any Issues at all on the backend
+     * \param[in] frame: The Frame to Fire
+     * \param[in] id: Identifies What is in the Frame, Give a New One Whenever the Frame is Recalculated or Reallocated.
+     * Firing the Same Id as the Resident Frame Only Sends Triggers, 0 Always Uploads
+     */
+    void Fire(const ScanData<params, usparams>& frame, const uint64_t id = 0) {
+
+        try {
+
+            if(id && id == resident) { // the whole frame is already in the queue, just trigger it
+
+                Trigger(0, FRAME_SIZE, 0, nullptr, 0);
+                return;
+
+            }
+
+            resident = 0;
+            havelast = false; // the last beam may have been from a frame that is gone now
+
+            uint32_t next = std::min(bank, FRAME_SIZE);
+            if(NeedsClear(next))
+                Clear();
+
+            Stage(frame, 0, next); // nothing is firing yet, so the first chunk goes out on its own
+            uint32_t offset = Commit(next);
+
+            for(uint32_t start = 0; start < FRAME_SIZE; ) {
+
+                const uint32_t count = next;
+                const uint32_t following = std::min(bank, FRAME_SIZE - start - count);
+
+                // the next chunk is staged between the triggers, unless it needs a clear, which would drop it
+                const bool overlap = following && !NeedsClear(following);
+                Trigger(offset, count, start + count, overlap ? &frame : nullptr, overlap ? following : 0);
+
+                if(following) {
+
+                    if(!overlap) {
+                        Clear();
+                        Stage(frame, start + count, following);
+                    }
+
+                    offset = Commit(following);
+
+                }
+
+                start += count;
+                next = following;
+
+            }
+
+            if(FRAME_SIZE <= 2 * bank && entries == FRAME_SIZE) // everything landed from entry 0, it can be fired again for free
+                resident = id;
+
+        }
+        catch(...) {
+
+            unknown = true; // don't know what made it into the queue, clear it before the next frame
+            resident = 0;
+            havelast = false;
+            throw;
+
+        }
+    }
+
+    /**
+     * \brief Clears the FPGA Queue and Forgets Everything that was Resident
+     * \throws ASICException: If there is an Issue with the ASIC
+     * \throws DriverException: If there are any Issues at all on the backend
+     */
+    void Reset() {
+
+        Clear();
+        resident = 0;
+
+    }
+
+    /**
+     * \brief Reads the Occupancy Back From the FPGA, Only Needed if Something Else Touched the Queue
+     * \throws ASICException: If there is an Issue with the ASIC
+     * \throws DriverException: If there are any Issues at all on the backend
+     * \return uint32_t: Entries in the Queue
+     */
+    uint32_t Sync() {
+
+        entries = asic.GetBeamQueueSize();
+        unknown = false;
+        resident = 0;
+        return entries;
+
+    }
+
+    /**
+     * \brief Get the Number of Entries the Manager Thinks Are in the FPGA Queue
+     *
+     * \return uint32_t: Queue Entries
+     */
+    uint32_t GetOccupancy() const noexcept { return entries; }
+
+    /**
+     * \brief Get the Size of One Bank, the Largest Chunk Uploaded at Once
+     *
+     * \return uint32_t: Entries in a Bank
+     */
+    uint32_t GetBankSize() const noexcept { return bank; }
+
+    /**
+     * \brief Get How Many Beams Were Sent as Repeats Instead of Full Beams
+     *
+     * \return uint64_t: Repeated Beams
+     */
+    uint64_t GetRepeatCount() const noexcept { return repeats; }
+
+private:
+
+    /**
+     * \brief Stages Beams to be Uploaded, Identical Consecutive Beams are Sent as Repeats
+     *
+     * \param[in] frame: Frame the Beams Come From
+     * \param[in] start: First Beam to Stage
+     * \param[in] count: How Many Beams to Stage
+     */
+    void Stage(const ScanData<params, usparams>& frame, const uint32_t start, const uint32_t count) {
+
+        for(uint32_t i = start; i < start + count; i++)
+            StageBeam(frame, i);
+
+    }
+
+    /**
+     * \brief Stages One Beam
+     */
+    void StageBeam(const ScanData<params, usparams>& frame, const uint32_t beam) {
+
+        if(havelast && Same(frame, beam)) {
+
+            Issue([this] { return asic.TryQueueRepeatBeam(); });
+            repeats++;
+
+        }
+        else {
+
+            if constexpr (params.usedelays)
+                Issue([&] { return asic.TryQueueBeam(frame.txdelays[beam], frame.rxdelays[beam]); });
+            else
+                Issue([&] { return asic.TryQueueBeam(frame.txcoeffs[beam], frame.rxcoeffs[beam]); });
+
+            last = beam;
+            lastframe = &frame;
+            havelast = true;
+
+        }
+
+        staged++;
+
+    }
+
+    /**
+     * \brief Checks if a Beam is the Same as the Last One Sent
+     */
+    bool Same(const ScanData<params, usparams>& frame, const uint32_t beam) const noexcept {
+
+        if constexpr (params.usedelays)
+            return frame.txdelays[beam] == lastframe->txdelays[last] && frame.rxdelays[beam] == lastframe->rxdelays[last];
+        else
+            return frame.txcoeffs[beam] == lastframe->txcoeffs[last] && frame.rxcoeffs[beam] == lastframe->rxcoeffs[last];
+
+    }
+
+    /**
+     * \brief Checks if a Chunk Only Fits After the Queue is Cleared
+     *
+     * \param[in] count: Beams in the Chunk
+     * \return true: If Both Banks are Used or What is in the Queue is Unknown
+     */
+    bool NeedsClear(const uint32_t count) const noexcept { return unknown || entries + count > 2 * bank; }
+
+    /**
+     * \brief Clears the Queue, Beams Staged on the Host and the Beam a Repeat Would Copy Go With it
+     * \throws DriverException: If it Failed
+     */
+    void Clear() {
+
+        LOGD("BeamQueue:: Clearing the Queue, {} Entries\n", entries);
+        Issue([this] { return asic.TryClearBeamQueue(); });
+        entries = 0;
+        staged = 0;
+        havelast = false;
+        unknown = false;
+
+    }
+
+    /**
+     * \brief Uploads the Staged Beams Into the Next Bank, the Caller Makes Sure They Fit
+     *
+     * \param[in] count: How Many Beams are Staged
+     * \return uint32_t: The Queue Entry the Chunk Starts at
+     */
+    uint32_t Commit(const uint32_t count) {
+
+        Issue([this] { return asic.TryFlushBeamQueue(); });
+        const uint32_t offset = entries;
+        entries += count;
+        staged = 0;
+        return offset;
+
+    }
+
+    /**
+     * \brief Triggers Entries in the Queue, Staging Beams From the Next Chunk in Between
+     *
+     * \param[in] offset: First Queue Entry to Trigger
+     * \param[in] count: How Many Entries to Trigger
+     * \param[in] nextstart: First Beam of the Next Chunk
+     * \param[in] frame: The Frame the Next Chunk is From, nullptr if There isn't One
+     * \param[in] nextcount: How Many Beams are in the Next Chunk
+     */
+    void Trigger(const uint32_t offset, const uint32_t count, const uint32_t nextstart, const ScanData<params, usparams>* frame, const uint32_t nextcount) {
+
+        for(uint32_t i = 0; i < count; i++) {
+
+            Issue([this, entry = uint8_t(offset + i)] { return asic.TryTriggerBeam(entry); }); // under the capacity, so it fits
+            if(frame && i < nextcount)
+                StageBeam(*frame, nextstart + i);
+
+        }
+
+        for(uint32_t i = count; frame && i < nextcount; i++) // in case the next chunk is bigger, which it never is
+            StageBeam(*frame, nextstart + i);
+
+    }
+
+    /**
+     * \brief Runs a Queue Command, Through the Scheduler if There is One
+     * \throws DriverException: If it Failed
+     * \param[in] call: The Non-Throwing ASIC Call
+     */
+    template<typename Call>
+    void Issue(Call&& call) {
+
+        if(scheduler)
+            scheduler->Run(call).Get();
+        else
+            call().Get();
+
+    }
+
+    ASIC<aparams>& asic;        ///< The ASIC the Beams Go Through
+    const uint32_t bank;        ///< Entries per Bank, Half the Queue
+    Scheduler* scheduler;       ///< Retries Busy Commands, nullptr if Not Used
+
+    uint32_t entries{0};        ///< Entries Uploaded to the FPGA Queue
+    uint32_t staged{0};         ///< Beams Staged but Not Uploaded
+    bool unknown{false};        ///< If an Error Left the Queue in an Unknown State
+
+    const ScanData<params, usparams>* lastframe{nullptr};  ///< Frame of the Last Full Beam Staged
+    uint32_t last{0};                                      ///< Index of the Last Full Beam Staged
+    bool havelast{false};                                  ///< If There is a Beam a Repeat Would Copy
+
+    uint64_t resident{0};                                  ///< Id of the Frame Sitting in the Queue From Entry 0, 0 if None
+    uint64_t repeats{0};                                   ///< Beams Sent as Repeats
+
+};
+
+}
@@ -0,0 +1,275 @@
+/**
+ * \file Beamformer.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Software Delay and Sum Beamformer, Forms Scan Lines From Per Channel RF Captures
+ * \version 0.1
+ * \date 2022-05-26
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "ASIC.hpp"
+#include "Controller.hpp"
+#include "Kernels.hpp"
+#include "Parameters.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace SoundCath {
+
+/// RF Samples of Every Channel From One Transmission
+struct RFFrame {
+
+    size_t channels{0};             ///< Number of Channels, 1024 Elements or 64 Group Outputs
+    size_t samples{0};              ///< Samples per Channel
+    std::vector<float> data;        ///< Sample s of Channel c is at c * samples + s
+
+    /**
+     * \brief Get the Samples of a Channel
+     *
+     * \param[in] channel: The Channel
+     * \return const float*: Its Samples
+     */
+    const float* GetChannel(const size_t channel) const noexcept { return data.data() + channel * samples; }
+
+};
+
+/// Beamformed Scan Lines, One per Beam
+struct BeamformedFrame {
+
+    size_t lines{0};                ///< Number of Lines, One per Beam
+    size_t samples{0};              ///< Samples per Line, the Same as the RF
+    std::vector<float> data;        ///< Sample s of Line l is at l * samples + s
+
+    /**
+     * \brief Get the Samples of a Line
+     *
+     * \param[in] line: The Line
+     * \return const float*: Its Samples
+     */
+    const float* GetLine(const size_t line) const noexcept { return data.data() + line * samples; }
+
+};
+
+/// The Receive Delay of Every Channel on Every Line, in Samples
+struct DelayTable {
+
+    size_t lines{0};                ///< Number of Lines
+    size_t channels{0};             ///< Number of Channels
+    std::vector<float> samples;     ///< Delay of Channel c on Line l is at l * channels + c
+
+};
+
+/**
+ * \brief Delay and Sum Beamformer for Per Channel RF Captures, Used to Cross Check the Micro Beamformed Output and for
+ * Research Modes That Need the Raw Channels
+ *
+ * Each Channel is Delayed by its Receive Delay, the Same Way the ASIC Delays it, Weighted by the Apodization and Summed:
+ * line[n] = sum over c of w[c] * rf[c](n - d[c]). The Delays are Fractional Samples, Filled in by Linear Interpolation.
+ *
+ * The Channels are Either the Elements, in the Element Order the Delays Use, or the Group Outputs After the Micro
+ * Beamformer. The Quantized Delays of a Delay Scan Only Steer Within a Group, a Few Hundred Nanoseconds, Steering Across
+ * the Array Takes Microseconds, so Their Channels are Also Delayed by the Coarse Delay of Their Group. Taylor Delays
+ * Cover the Whole Aperture and Need Nothing More. A Group Output Already has its Elements' Delays Applied by the ASIC.
+ * The Delays are Fixed Over the Line, the Dynamic Rx Curves the ASIC Follows With Depth Aren't Modelled.
+ *
+ * A Line is Summed a Channel at a Time Over Every Sample With \ref SIMD, and the Lines are Spread Over a Thread Pool.
+ * Without FMA Contraction, Which Release Builds Turn Off, Every Instruction Set Matches Bit for Bit.
+ */
+class Beamformer {
+
+public:
+
+    /// What the Channels of the RF are
+    enum Channels : uint8_t {
+
+        ELEMENTS,   ///< Every Element, Straight From the Transducer
+        GROUPS      ///< Every Group, the Output of the Micro Beamformer
+
+    };
+
+    /// Apodization Window Across the Aperture
+    enum Window : uint8_t {
+
+        RECTANGULAR,    ///< Every Channel Weighted the Same
+        HANN            ///< Hann Window in X and Y, Lower Side Lobes for a Wider Main Lobe
+
+    };
+
+    /**
+     * \brief Construct a new Beamformer object, Works Out the Apodization
+     *
+     * \param[in] tparams: The Transducer Geometry
+     * \param[in] samplerate_hz: The Sample Rate of the RF
+     * \param[in] delay_res_ns: The Rx Delay Resolution the Delays are in
+     * \param[in] channels: What the Channels of the RF are
+     * \param[in] window: The Apodization
+     */
+    Beamformer(const TransducerParams& tparams, const double samplerate_hz, const double delay_res_ns, const Channels channels = ELEMENTS, const Window window = HANN);
+
+    /**
+     * \brief Get the Number of Channels an RF Frame has to Have
+     *
+     * \return size_t: The Number of Elements or Groups
+     */
+    size_t GetChannelCount() const noexcept { return apodization.size(); }
+
+    /**
+     * \brief Get the Weight of Every Channel
+     *
+     * \return const std::vector<float>&: The Weights
+     */
+    const std::vector<float>& GetApodization() const noexcept { return apodization; }
+
+    /**
+     * \brief Replaces the Apodization
+     *
+     * \throws ConfigException: If There isn't a Weight for Every Channel
+     * \param[in] weights: The Weight of Every Channel
+     */
+    void SetApodization(std::vector<float> weights);
+
+    /**
+     * \brief Turns the Fine Element Delays of a Line Into Channel Delays, Group Outputs Already Have Them so Get 0
+     *
+     * \param[in] delays: Delay of Every Element in Rx Delay Res Units
+     * \param[out] samples: Delay of Every Channel in Samples, \ref GetChannelCount of Them
+     */
+    void GetChannelDelays(const Delays& delays, float* samples) const noexcept;
+
+    /**
+     * \copydoc GetChannelDelays(const Delays&, float*) const
+     */
+    void GetChannelDelays(const QuantDelays& delays, float* samples) const noexcept;
+
+    /**
+     * \copydoc GetChannelDelays(const Delays&, float*) const
+     */
+    void GetChannelDelays(const QuantRxDelays& delays, float* samples) const noexcept;
+
+    /**
+     * \brief Adds the Coarse Delay of Every Group to its Channels, Worked Out From Where the Group Sits and the Beam
+     * Direction the Same Way \ref RXController::CalculateDelays Steers Within a Group
+     *
+     * \param[in] x_deg: The Beam Angle in the X Direction
+     * \param[in] y_deg: The Beam Angle in the Y Direction
+     * \param[in,out] samples: Delay of Every Channel in Samples, \ref GetChannelCount of Them
+     */
+    void AddGroupDelays(const double x_deg, const double y_deg, float* samples) const noexcept;
+
+    /**
+     * \brief Puts Delays in the Order the ASIC Hands the Channels Back in Into the Transducer Order the Beamformer Uses
+     *
+     * The ASIC Lays its Groups Out 16 in X by 4 in Y, see \ref TaylorKernel::GROUPS_X, the Transducer 4 in X by 16 in
+     * Y, so the ASIC's Grid is the Transducer's Transposed, Groups and the Elements Within Them Alike.
+     *
+     * \param[in] delays: Delay of Every Element in the ASIC's Order
+     * \return QuantDelays: The Same Delays in Transducer Order
+     */
+    static QuantDelays ToTransducerOrder(const QuantDelays& delays) noexcept;
+
+    /**
+     * \brief Gets the Receive Delays of Every Beam of a Scan
+     *
+     * Delay Scans Use the Quantized Delays as They are. Taylor Scans are Decompressed the Way the ASIC Does it, see
+     * \ref TaylorKernel::UncompressRx, and Put Back in Transducer Order, see \ref ToTransducerOrder. The Quantized
+     * Delays Only Steer Within a Group so Delay Scans Get the Coarse Group Delays on Top, see \ref AddGroupDelays, the
+     * Taylor Delays Already Cover the Whole Aperture.
+     *
+     * \param[in] data: The Scan Tables
+     * \return DelayTable: The Delays, One Line per Beam
+     */
+    template<ControllerParams params, TransducerParams tparams>
+    DelayTable GetDelays(const ScanData<params, tparams>& data) const {
+
+        DelayTable table;
+        table.lines = ScanData<params, tparams>::BEAMS;
+        table.channels = GetChannelCount();
+        table.samples.resize(table.lines * table.channels);
+
+        for(size_t beam = 0; beam < table.lines; beam++) {
+
+            float* const line = table.samples.data() + beam * table.channels;
+            if constexpr (params.usedelays) {
+
+                const BeamGeometry geometry = GetBeamGeometry(params, int(beam % params.x_steps), int(beam / params.x_steps));
+                GetChannelDelays(data.rxdelays[beam], line);
+                AddGroupDelays(geometry.x_deg, geometry.y_deg, line);
+
+            }
+            else {
+
+                QuantDelays delays;
+                QuantPhases phases;
+                TaylorKernel::UncompressRx(data.rxcoeffs[beam], delays, phases);
+                GetChannelDelays(ToTransducerOrder(delays), line);
+
+            }
+        }
+
+        return table;
+
+    }
+
+    /**
+     * \brief Forms One Line
+     *
+     * \throws ConfigException: If the Frame Doesn't Have \ref GetChannelCount Channels
+     * \param[in] frame: The RF
+     * \param[in] delays: Delay of Every Channel in Samples
+     * \param[out] line: The Line, as Many Samples as the Frame
+     */
+    void FormLine(const RFFrame& frame, const float* delays, float* line) const;
+
+    /**
+     * \brief Forms Every Line of a Table From One Transmission, the Lines are Spread Over a Thread Pool
+     *
+     * \throws ConfigException: If the Frame or the Table Doesn't Have \ref GetChannelCount Channels
+     * \param[in] frame: The RF
+     * \param[in] delays: The Delays of Every Line
+     * \param[out] image: The Lines, Resized to Fit
+     * \param[in] pool: Threads to Form the Lines on
+     */
+    void Form(const RFFrame& frame, const DelayTable& delays, BeamformedFrame& image, ThreadPool& pool) const;
+
+    /**
+     * \brief Forms Every Line of a Table, Each From its Own Transmission, the Lines are Spread Over a Thread Pool
+     *
+     * \throws ConfigException: If There isn't a Frame per Line, a Frame has Another Size or the Wrong Channels
+     * \param[in] frames: The RF of Every Line
+     * \param[in] delays: The Delays of Every Line
+     * \param[out] image: The Lines, Resized to Fit
+     * \param[in] pool: Threads to Form the Lines on
+     */
+    void Form(const std::vector<RFFrame>& frames, const DelayTable& delays, BeamformedFrame& image, ThreadPool& pool) const;
+
+private:
+
+    /**
+     * \brief Scales Element Delays to Samples, or Zeroes the Group Outputs
+     *
+     * \param[in] delays: Delay of Every Element in Rx Delay Res Units
+     * \param[out] samples: Delay of Every Channel in Samples
+     */
+    template<typename T, size_t N>
+    void ToChannels(const std::array<T, N>& delays, float* samples) const noexcept;
+
+    /// Adds One Channel Into a Line, Weighted and Delayed by a Whole Number of Samples Plus a Fraction
+    static void Accumulate(const float* rf, float* line, const size_t samples, const float weight, const float delay) noexcept;
+
+    std::vector<float> apodization;     ///< Weight of Every Channel
+    std::vector<double> groupx;         ///< X of Every Group From the Middle of the Array, in Samples the Sound Takes to Get There
+    std::vector<double> groupy;         ///< Y of Every Group From the Middle of the Array, in Samples the Sound Takes to Get There
+    Channels mode;                      ///< What the Channels are
+    size_t elements;                    ///< Number of Elements in Use
+    size_t pergroup;                    ///< Channels in a Group, 1 for Groups
+    double scale;                       ///< Turns Rx Delay Res Units Into Samples
+
+};
+
+}
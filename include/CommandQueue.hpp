@@ -0,0 +1,120 @@
+/**
+ * \file CommandQueue.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Bounded Command Queue that Feeds the Driver's IO Thread
+ * \version 0.1
+ * \date 2022-05-02
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <deque>
+#include <future>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+namespace SoundCath {
+
+/// Completion Callback for an Asynchronous Command, gets the Response and the Driver Return Code
+typedef std::function<void(const std::string& response, const uint32_t result)> CommandCallback;
+
+/**
+ * \brief A Command That is Waiting to be Sent to the Device by the IO Thread
+ *
+ * Either the Promise or the Callback is Used to Report Completion, Never Both
+ */
+struct Command {
+
+    std::string command;                    ///< The Command String to Send
+    std::promise<std::string> response;     ///< Fulfilled With the Response or the Driver Exception
+    CommandCallback callback;               ///< If Set, Called Instead of Fulfilling the Promise
+
+};
+
+/**
+ * \brief A Bounded FIFO of Commands, Producers Block When it is Full, the Consumer Blocks When it is Empty
+ *
+ * \note Commands are Popped in the Order they are Pushed, that is what Gives the Driver its Per Device Ordering
+ */
+class CommandQueue {
+
+public:
+
+    /**
+     * \brief Construct a new Command Queue object
+     *
+     * \param[in] capacity: The Maximum Number of Commands Waiting to Be Sent
+     */
+    CommandQueue(const size_t capacity);
+
+    /**
+     * \brief Adds a Command to the Back of the Queue, Blocks While the Queue is Full
+     *
+     * \param[in] command: The Command to Queue
+     * \return true: If the Command Was Queued
+     * \return false: If the Queue Was Closed
+     */
+    bool Push(Command&& command);
+
+    /**
+     * \brief Takes the Command at the Front of the Queue, Blocks While the Queue is Empty
+     *
+     * \param[out] command: Where to Move the Command To
+     * \return true: If a Command Was Taken
+     * \return false: If the Queue Was Closed and Drained
+     */
+    bool Pop(Command& command);
+
+    /**
+     * \brief Marks the Last Popped Command as Finished, Wakes up Anyone Waiting for the Queue to Drain
+     *
+     */
+    void Done() noexcept;
+
+    /**
+     * \brief Blocks Until Every Pushed Command Has Been Popped and Finished
+     *
+     */
+    void WaitIdle() const;
+
+    /**
+     * \brief Stops Accepting Commands, Wakes up the Consumer Once the Remaining Commands are Drained
+     *
+     */
+    void Close() noexcept;
+
+    /**
+     * \brief Get the Number of Commands That are Queued or in Flight
+     *
+     * \return size_t: Commands Not Yet Finished
+     */
+    size_t Pending() const noexcept;
+
+    /**
+     * \brief Get the Capacity of the Queue
+     *
+     * \return size_t: The Max Number of Queued Commands
+     */
+    size_t GetCapacity() const noexcept { return capacity; }
+
+private:
+
+    const size_t capacity;                  ///< The Max Number of Queued Commands
+    std::deque<Command> commands;           ///< The Queued Commands
+    size_t inflight{0};                     ///< Commands Popped but not Finished
+    bool closed{false};                     ///< If the Queue Has Stopped Taking Commands
+
+    mutable std::mutex lock;                ///< Guards Everything Above
+    std::condition_variable notfull;        ///< Signalled When a Command is Popped
+    std::condition_variable notempty;       ///< Signalled When a Command is Pushed
+    mutable std::condition_variable idle;   ///< Signalled When the Queue Drains
+
+};
+
+}
\ No newline at end of file
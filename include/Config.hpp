@@ -0,0 +1,454 @@
+/**
+ * \file Config.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Parameter File Parser, Reads a \ref USParams From a Config File at Startup or While Compiling
+ * \version 0.1
+ * \date 2022-05-22
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Parameters.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace SoundCath {
+
+/**
+ * \brief Throws a \ref ConfigException for a Line That Can't be Parsed
+ *
+ * Not constexpr on Purpose, a Preset Parsed While Compiling That Reaches it Fails the Build at the Bad Line
+ * \param[in] line: The Line Number, Counting From 1
+ * \param[in] what: What is Wrong
+ * \param[in] text: The Text at Fault
+ */
+[[noreturn]] void ThrowParseError(const size_t line, const std::string_view what, const std::string_view text);
+
+/**
+ * \brief Throws a \ref ConfigException for a Field Outside its Documented Range
+ *
+ * Not constexpr on Purpose, see \ref ThrowParseError
+ * \param[in] key: The Field, as it is Named in the File
+ * \param[in] value: What it Was Set to
+ * \param[in] min: The Smallest Allowed Value
+ * \param[in] max: The Largest Allowed Value
+ */
+[[noreturn]] void ThrowRangeError(const std::string_view key, const int64_t value, const int64_t min, const int64_t max);
+
+/**
+ * \brief Throws a \ref ConfigException for Parameters That are Wrong as a Whole
+ *
+ * Not constexpr on Purpose, see \ref ThrowParseError
+ * \param[in] message: What is Wrong
+ */
+[[noreturn]] void ThrowConfigError(const std::string_view message);
+
+/**
+ * \brief Parses a Whole Number, No Sign Other Than a Leading '-'
+ *
+ * \param[in] text: The Number, Trimmed
+ * \param[out] value: The Number, Left Alone if it Doesn't Parse
+ * \return true: If it Parsed and Fits in 64 Bits
+ */
+constexpr bool ParseInteger(const std::string_view text, int64_t& value) noexcept {
+
+    const bool negative = !text.empty() && text.front() == '-';
+    const std::string_view digits = text.substr(negative);
+    if(digits.empty())
+        return false;
+
+    uint64_t magnitude = 0;
+    for(const char c: digits) {
+
+        if(c < '0' || c > '9' || magnitude > (uint64_t(std::numeric_limits<int64_t>::max()) - (c - '0')) / 10)
+            return false;
+
+        magnitude = magnitude * 10 + (c - '0');
+
+    }
+
+    value = negative ? -int64_t(magnitude) : int64_t(magnitude);
+    return true;
+
+}
+
+/**
+ * \brief Parses a Decimal Number, "1540", "-0.5", ".5" and "1.5e-3" are All Fine
+ *
+ * Up to 15 Significant Digits With an Exponent Within 22 is Exact and Rounded Once, the Same at Compile Time and at
+ * Runtime, Which Covers Every Value a Preset Realistically has. Longer Numbers are Close but can be Off in the Last Bit.
+ * \param[in] text: The Number, Trimmed
+ * \param[out] value: The Number, Left Alone if it Doesn't Parse
+ * \return true: If it Parsed
+ */
+constexpr bool ParseDecimal(std::string_view text, double& value) noexcept {
+
+    const bool negative = !text.empty() && text.front() == '-';
+    text.remove_prefix(negative);
+
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    size_t digits = 0;
+    bool point = false;
+
+    for(; !text.empty() && ((text.front() >= '0' && text.front() <= '9') || (text.front() == '.' && !point)); text.remove_prefix(1)) {
+
+        if(text.front() == '.') {
+            point = true;
+            continue;
+        }
+
+        if(mantissa < 100'000'000'000'000'000) { // 18 digits, anything past that is too small to matter
+            mantissa = mantissa * 10 + (text.front() - '0');
+            exponent -= point;
+        }
+        else
+            exponent += !point;
+
+        digits++;
+
+    }
+
+    if(!digits)
+        return false;
+
+    if(!text.empty()) {
+
+        if(text.front() != 'e' && text.front() != 'E')
+            return false;
+
+        int64_t power = 0;
+        if(!ParseInteger(text.substr(1), power) || power > 400 || power < -400)
+            return false;
+
+        exponent += int(power);
+
+    }
+
+    constexpr std::array<double, 23> POWERS = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+                                                1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    double result = double(mantissa);
+    if(mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) // both exact so one rounding
+        result = exponent < 0 ? result / POWERS[-exponent] : result * POWERS[exponent];
+    else {
+        for(; exponent > 0; exponent -= std::min(exponent, 22))
+            result *= POWERS[std::min(exponent, 22)];
+        for(; exponent < 0; exponent += std::min(-exponent, 22))
+            result /= POWERS[std::min(-exponent, 22)];
+    }
+
+    value = negative ? -result : result;
+    return true;
+
+}
+
+/**
+ * \brief Parses a Value Into a Field of Whatever Type it is, Nothing is Allocated
+ *
+ * \param[in] text: The Value, Trimmed
+ * \param[out] field: Where it Goes, Left Alone if it Doesn't Parse
+ * \return true: If it Parsed and Fits the Field
+ */
+template<typename T>
+constexpr bool ParseValue(const std::string_view text, T& field) noexcept {
+
+    if constexpr (std::is_same_v<T, bool>) {
+
+        if(text != "true" && text != "false")
+            return false;
+
+        field = text == "true";
+        return true;
+
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+
+        double value = 0;
+        if(!ParseDecimal(text, value))
+            return false;
+
+        field = T(value);
+        return true;
+
+    }
+    else {
+
+        using Integer = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::type_identity<T>>::type;
+
+        int64_t value = 0;
+        if(!ParseInteger(text, value) || !std::in_range<Integer>(value))
+            return false;
+
+        field = T(Integer(value));
+        return true;
+
+    }
+}
+
+/// Sets One Field of the Parameters From the Text of its Value
+typedef bool (*ConfigSetter)(USParams& params, std::string_view value);
+
+/**
+ * \brief Follows a Chain of Member Pointers Down From the Parameters to a Field and Parses the Value Into it
+ *
+ * \tparam members: The Member Pointers, Outermost First
+ */
+template<auto... members>
+constexpr bool SetField(USParams& params, const std::string_view value) noexcept {
+
+    return ParseValue(value, (params .* ... .* members));
+
+}
+
+/// A Key in the File and the Field it Sets
+struct ConfigField {
+
+    std::string_view section;   ///< The Section it is Under, Empty at the Top
+    std::string_view key;       ///< The Key in That Section
+    ConfigSetter set;           ///< Sets the Field
+
+};
+
+/// Every Key the File can Have
+inline constexpr std::array CONFIG_FIELDS = {
+
+    ConfigField{ "", "attenuation", &SetField<&USParams::attenuation> },
+    ConfigField{ "", "freq_cent_mhz", &SetField<&USParams::freq_cent_mhz> },
+
+    ConfigField{ "pulse", "type", &SetField<&USParams::pulse, &USParams::Pulse::type> },
+    ConfigField{ "pulse", "subtype", &SetField<&USParams::pulse, &USParams::Pulse::subtype> },
+
+    ConfigField{ "transducer", "pitch_nm", &SetField<&USParams::trparams, &TransducerParams::pitch_nm> },
+    ConfigField{ "transducer", "group_pitch_nm", &SetField<&USParams::trparams, &TransducerParams::group_pitch_nm> },
+    ConfigField{ "transducer", "soundspeed", &SetField<&USParams::trparams, &TransducerParams::soundspeed> },
+    ConfigField{ "transducer", "numgroups", &SetField<&USParams::trparams, &TransducerParams::numgroups> },
+    ConfigField{ "transducer", "ygroups", &SetField<&USParams::trparams, &TransducerParams::ygroups> },
+    ConfigField{ "transducer", "xgroups", &SetField<&USParams::trparams, &TransducerParams::xgroups> },
+    ConfigField{ "transducer", "xelems", &SetField<&USParams::trparams, &TransducerParams::xelems> },
+    ConfigField{ "transducer", "yelems", &SetField<&USParams::trparams, &TransducerParams::yelems> },
+    ConfigField{ "transducer", "elempergroup", &SetField<&USParams::trparams, &TransducerParams::elempergroup> },
+    ConfigField{ "transducer", "numelements", &SetField<&USParams::trparams, &TransducerParams::numelements> },
+
+    ConfigField{ "controller", "x_max_deg", &SetField<&USParams::conparams, &ControllerParams::x_max_deg> },
+    ConfigField{ "controller", "x_min_deg", &SetField<&USParams::conparams, &ControllerParams::x_min_deg> },
+    ConfigField{ "controller", "x_steps", &SetField<&USParams::conparams, &ControllerParams::x_steps> },
+    ConfigField{ "controller", "y_max_deg", &SetField<&USParams::conparams, &ControllerParams::y_max_deg> },
+    ConfigField{ "controller", "y_min_deg", &SetField<&USParams::conparams, &ControllerParams::y_min_deg> },
+    ConfigField{ "controller", "y_steps", &SetField<&USParams::conparams, &ControllerParams::y_steps> },
+    ConfigField{ "controller", "z_min_mm", &SetField<&USParams::conparams, &ControllerParams::z_min_mm> },
+    ConfigField{ "controller", "z_max_mm", &SetField<&USParams::conparams, &ControllerParams::z_max_mm> },
+    ConfigField{ "controller", "depth_range", &SetField<&USParams::conparams, &ControllerParams::depth_range> },
+    ConfigField{ "controller", "z_steps", &SetField<&USParams::conparams, &ControllerParams::z_steps> },
+    ConfigField{ "controller", "focus_rx", &SetField<&USParams::conparams, &ControllerParams::focus_rx> },
+    ConfigField{ "controller", "focus_tx", &SetField<&USParams::conparams, &ControllerParams::focus_tx> },
+    ConfigField{ "controller", "usedelays", &SetField<&USParams::conparams, &ControllerParams::usedelays> },
+
+    ConfigField{ "controller.tx", "xmax", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::xmax> },
+    ConfigField{ "controller.tx", "ymax", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::ymax> },
+    ConfigField{ "controller.tx", "L1", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::L1> },
+    ConfigField{ "controller.tx", "L2", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::L2> },
+    ConfigField{ "controller.tx", "L3", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::L3> },
+    ConfigField{ "controller.tx", "L4_sq", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::L4_sq> },
+    ConfigField{ "controller.tx", "delay_res_ns", &SetField<&USParams::conparams, &ControllerParams::txparams, &ControllerParams::TxParams::delay_res_ns> },
+
+    ConfigField{ "controller.rx", "L0", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::L0> },
+    ConfigField{ "controller.rx", "L1", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::L1> },
+    ConfigField{ "controller.rx", "L2", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::L2> },
+    ConfigField{ "controller.rx", "L1MAX", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::L1MAX> },
+    ConfigField{ "controller.rx", "L2MAX", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::L2MAX> },
+    ConfigField{ "controller.rx", "c78factor", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::c78factor> },
+    ConfigField{ "controller.rx", "start_depth_m", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::start_depth_m> },
+    ConfigField{ "controller.rx", "stop_depth_m", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::stop_depth_m> },
+    ConfigField{ "controller.rx", "delay_res_ns", &SetField<&USParams::conparams, &ControllerParams::rxparams, &ControllerParams::RxParams::delay_res_ns> },
+
+    ConfigField{ "asic", "speed", &SetField<&USParams::asicparams, &ASICParams::speed> },
+
+    ConfigField{ "asic.core", "ISelLNA", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::ISelLNA> },
+    ConfigField{ "asic.core", "ISelOdrv", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::ISelOdrv> },
+    ConfigField{ "asic.core", "ISelResCtrl", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::ISelResCtrl> },
+    ConfigField{ "asic.core", "ISelDcGND", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::ISelDcGND> },
+    ConfigField{ "asic.core", "ResCal", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::ResCal> },
+    ConfigField{ "asic.core", "AnalogResetNoRx", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::AnalogResetNoRx> },
+    ConfigField{ "asic.core", "AnalogResetAuto", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::AnalogResetAuto> },
+    ConfigField{ "asic.core", "LNAAutoPowerDown", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::LNAAutoPowerDown> },
+    ConfigField{ "asic.core", "BiasEn", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::BiasEn> },
+    ConfigField{ "asic.core", "ODrvEn", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::ODrvEn> },
+    ConfigField{ "asic.core", "RxAlwaysEn", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::RxAlwaysEn> },
+    ConfigField{ "asic.core", "CWEn", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::CWEn> },
+    ConfigField{ "asic.core", "LNAEn", &SetField<&USParams::asicparams, &ASICParams::core, &ASICParams::CoreSettings::LNAEn> },
+
+    ConfigField{ "asic.timing", "SetupTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::SetupTime> },
+    ConfigField{ "asic.timing", "RunRxTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::RunRxTime> },
+    ConfigField{ "asic.timing", "RunTXTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::RunTXTime> },
+    ConfigField{ "asic.timing", "StopTXTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::StopTXTime> },
+    ConfigField{ "asic.timing", "StopRXTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::StopRXTime> },
+    ConfigField{ "asic.timing", "AnaResetStopTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::AnaResetStopTime> },
+    ConfigField{ "asic.timing", "PreChargeTime", &SetField<&USParams::asicparams, &ASICParams::timing, &ASICParams::BeamTiming::PreChargeTime> },
+
+    ConfigField{ "asic.drv", "Enable", &SetField<&USParams::asicparams, &ASICParams::drvconfig, &ASICParams::DRVConfig::Enable> },
+    ConfigField{ "asic.drv", "FFen", &SetField<&USParams::asicparams, &ASICParams::drvconfig, &ASICParams::DRVConfig::FFen> },
+    ConfigField{ "asic.drv", "Bias", &SetField<&USParams::asicparams, &ASICParams::drvconfig, &ASICParams::DRVConfig::Bias> },
+
+    ConfigField{ "asic.bmode", "usequeue", &SetField<&USParams::asicparams, &ASICParams::bmodesettings, &ASICParams::BModeSettings::usequeue> },
+    ConfigField{ "asic.bmode", "depthrange", &SetField<&USParams::asicparams, &ASICParams::bmodesettings, &ASICParams::BModeSettings::depthrange> },
+    ConfigField{ "asic.bmode", "dbrange", &SetField<&USParams::asicparams, &ASICParams::bmodesettings, &ASICParams::BModeSettings::dbrange> },
+
+    ConfigField{ "fpga", "DisableLED", &SetField<&USParams::fpgaparams, &FPGAParams::DisableLED> }
+
+};
+
+/// Cuts the Spaces and Tabs off Both Ends
+constexpr std::string_view TrimSpaces(std::string_view text) noexcept {
+
+    while(!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+        text.remove_prefix(1);
+
+    while(!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+        text.remove_suffix(1);
+
+    return text;
+
+}
+
+/**
+ * \brief Checks a Field is Within its Range
+ *
+ * \tparam members: The Member Pointers Down to the Field, Outermost First
+ * \throws ConfigException: If it Isn't
+ */
+template<auto... members>
+constexpr void CheckRange(const USParams& params, const std::string_view key, const int64_t min, const int64_t max) {
+
+    const int64_t value = int64_t((params .* ... .* members));
+    if(value < min || value > max)
+        ThrowRangeError(key, value, min, max);
+
+}
+
+/**
+ * \brief Checks the Parameters Against the Ranges Documented in Parameters.hpp, Anything the Hardware Would Reject or
+ * Misread Because the Field is Wider Than the Register
+ *
+ * \throws ConfigException: Naming the First Field Out of Range
+ * \param[in] params: The Parameters to Check
+ */
+constexpr void ValidateParams(const USParams& params) {
+
+    using Core = ASICParams::CoreSettings;
+
+    CheckRange<&USParams::pulse, &USParams::Pulse::type>(params, "pulse.type", USParams::Pulse::UNIPOLAR, USParams::Pulse::UNIPOLAR);
+    CheckRange<&USParams::pulse, &USParams::Pulse::subtype>(params, "pulse.subtype", USParams::Pulse::FIFTY_GAIN8, USParams::Pulse::HUNDRED_NEG_GAIN8);
+
+    CheckRange<&USParams::conparams, &ControllerParams::x_steps>(params, "controller.x_steps", 1, std::numeric_limits<uint8_t>::max());
+    CheckRange<&USParams::conparams, &ControllerParams::y_steps>(params, "controller.y_steps", 1, std::numeric_limits<uint8_t>::max());
+
+    CheckRange<&USParams::asicparams, &ASICParams::core, &Core::ISelLNA>(params, "asic.core.ISelLNA", 0, 15);
+    CheckRange<&USParams::asicparams, &ASICParams::core, &Core::ISelOdrv>(params, "asic.core.ISelOdrv", 0, 15);
+    CheckRange<&USParams::asicparams, &ASICParams::core, &Core::ISelResCtrl>(params, "asic.core.ISelResCtrl", 0, 15);
+    CheckRange<&USParams::asicparams, &ASICParams::core, &Core::ISelDcGND>(params, "asic.core.ISelDcGND", 0, 15);
+    CheckRange<&USParams::asicparams, &ASICParams::core, &Core::ResCal>(params, "asic.core.ResCal", 0, 7);
+
+    if(params.asicparams.speed != ASICParams::LOW && params.asicparams.speed != ASICParams::HIGH)
+        ThrowConfigError("The ASIC Speed has to be 25 or 100 MHz");
+
+}
+
+/**
+ * \brief Parses a Parameter Set From the Text of a Config File
+ *
+ * The Format is a Small Part of TOML: "[section]" Headers, "key = value" Lines and "#" Comments. Values are Numbers or
+ * true/false. The Sections and Keys are the Names of the Structs and Fields in Parameters.hpp:
+ *
+ *     attenuation = 0.5
+ *     [transducer]
+ *     soundspeed = 1540.0
+ *     [controller]
+ *     x_steps = 32
+ *     [controller.tx]
+ *     delay_res_ns = 12.5
+ *     [asic]
+ *     speed = 100
+ *     [asic.core]
+ *     ISelLNA = 4
+ *
+ * The Other Sections are [pulse], [controller.rx], [asic.timing], [asic.drv], [asic.bmode] and [fpga]. Anything Not
+ * Given Keeps its Default, and the Result is Checked With \ref ValidateParams.
+ *
+ * It is constexpr so a Preset can be Parsed While Compiling, see Preset.hpp. It Gives the Same Parameters Either Way,
+ * and a Bad Preset Fails the Build Instead of Throwing.
+ *
+ * \throws ConfigException: If a Line Can't be Parsed, a Key is Unknown or a Value Doesn't Fit its Field
+ * \param[in] text: The Contents of the File
+ * \return USParams: The Parameters
+ */
+constexpr USParams ParseParams(std::string_view text) {
+
+    USParams params{};
+    std::string_view section;
+
+    for(size_t number = 1; !text.empty(); number++) {
+
+        const size_t newline = text.find('\n');
+        std::string_view line = text.substr(0, newline);
+        text.remove_prefix(newline == std::string_view::npos ? text.size() : newline + 1);
+
+        line = TrimSpaces(line.substr(0, line.find('#')));
+        if(line.empty())
+            continue;
+
+        if(line.front() == '[') {
+
+            if(line.back() != ']' || line.size() < 3)
+                ThrowParseError(number, "Bad Section Header", line);
+
+            section = TrimSpaces(line.substr(1, line.size() - 2));
+            continue;
+
+        }
+
+        const size_t equals = line.find('=');
+        if(equals == std::string_view::npos)
+            ThrowParseError(number, "Expected \"key = value\", Got", line);
+
+        const std::string_view key = TrimSpaces(line.substr(0, equals));
+        const std::string_view value = TrimSpaces(line.substr(equals + 1));
+
+        const ConfigField* field = nullptr;
+        for(const ConfigField& candidate: CONFIG_FIELDS)
+            if(candidate.section == section && candidate.key == key)
+                field = &candidate;
+
+        if(!field)
+            ThrowParseError(number, "Unknown Key", line);
+
+        if(!field->set(params, value))
+            ThrowParseError(number, "Bad Value", line);
+
+    }
+
+    ValidateParams(params);
+    return params;
+
+}
+
+/**
+ * \brief Reads a Parameter Set From a Config File, see \ref ParseParams for the Format
+ *
+ * \throws ConfigException: If the File Can't be Read or Parsed
+ * \param[in] path: Path to the File
+ * \return USParams: The Parameters
+ */
+USParams LoadParams(const std::string& path);
+
+}
@@ -19,8 +19,14 @@
 /// min_element and max_element and other func stuff
 #include <algorithm>
 
+#include <memory>
+#include <type_traits>
+
 #include "ASIC.hpp"
 #include "FPGA.hpp"
+#include "Format.hpp"
+#include "ThreadPool.hpp"
+#include "Kernels.hpp"
 
 /// Compile Time Math Library, I have Contributed to its development and made it Windows Compatible (Generalized Compile Expression Math) same api as std::math
 #include <gcem.hpp>
@@ -72,7 +78,7 @@ public:
      * 
      * \returns TxTaylor: The Taylor Polynomial \ref TxTaylor 
      */
-    static consteval TxTaylor CompressTaylor(const double x, const double y, const double z, const double beamoffset_s) noexcept {
+    static constexpr TxTaylor CompressTaylor(const double x, const double y, const double z, const double beamoffset_s) noexcept {
 
         const double r = gcem::sqrt(gcem::pow(x, 2) + gcem::pow(y, 2) + gcem::pow(z, 2));
         const double x_r = x / r;
@@ -122,7 +128,7 @@ public:
      * \param[in] z: Z in 3-D Space
      * \return Delays: The Delays that Would hit that point, evaluated   
      */
-    static consteval Delays CalculateDelays(const double x, const double y, const double z) noexcept {
+    static constexpr Delays CalculateDelays(const double x, const double y, const double z) noexcept {
 
         const long double r = gcem::sqrt(gcem::pow(x, 2) + gcem::pow(y, 2) + gcem::pow(z, 2));
         Delays delays{};
@@ -149,27 +155,79 @@ public:
             }
         }
 
-        int8_t offset = -*std::min_element(std::begin(delays), std::end(delays));
+        const double offset = -*std::min_element(std::begin(delays), std::end(delays)); // shift so the first element fires at 0
 
         for(int i = 0; i < usparams.numelements; i++)
-            delays[i] += offset/ (params.delay_res_ns * gcem::pow(10.0, -9.0));
+            delays[i] += offset; // already in units of the delay resolution
 
         return delays;
 
 }
     
     /**
-     * \brief Calculates the Delays for a Given Reception Taylor Polynomial
+     * \brief Calculates the Delays the ASIC Fires With for a Transmission Taylor Polynomial
      * 
-     * \note Implement this according to Oldeft MATLAB Code
-     * \todo Write this
+     * \note Integer for Integer the Same as DelayUncompressionTxAsic in the Oldelft MATLAB Scripts, \ref TaylorKernel::UncompressTx is the Fast Version
      * 
      * \param[in] coeffs: The Coefficients to Decompress
-     * \return Delays: The Caclulated Delays According to the Taylor Polynomial 
+     * \return QuantDelays: The Delays in Tx Delay Res Units, in the ASIC's Element Order
      */
-    static consteval Delays UncompressTaylor(const TxCoeffs coeffs) noexcept {
+    static constexpr QuantDelays UncompressTaylor(const TxCoeffs& coeffs) noexcept {
 
-        return Delays();
+        using K = TaylorKernel;
+
+        QuantDelays delays{};
+        const int32_t c[8] = { coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4], coeffs[5], coeffs[6], coeffs[7] };
+
+        for(int32_t y = 0; y < K::GROUPS_Y; y++) {
+
+            const int32_t y0 = y + K::GROUP_OFFSET_Y;
+
+            for(int32_t x = 0; x < K::GROUPS_X; x++) {
+
+                // >> is a floor division on the signed values, same as the MATLAB floor(a / 2^n)
+                int32_t group = c[0] * (1 << K::TX_FP);
+                group += (c[4] * K::TX_LINEAR[y0]) >> K::TX_FP;
+                group += (c[5] * K::TX_SQUARE[y0]) >> K::TX_FP;
+                group += (c[6] * K::TX_CUBE[y0]) >> K::TX_FP;
+                group += (c[1] * K::TX_LINEAR[x]) >> K::TX_FP;
+                group += (c[2] * K::TX_SQUARE[x]) >> K::TX_FP;
+                group += (c[3] * K::TX_CUBE[x]) >> K::TX_FP;
+                group += (c[7] * K::TX_LINEARXY[x] * K::TX_LINEARXY[y0]) >> (K::TX_FP + 1);
+                group = (std::max(group, 0) >> K::TX_FP) & 0x1FF; // 9 bits, the LSB goes to the elements
+
+                int32_t dy = c[4] * (1 << (K::TX_FP + 1));
+                dy += (c[5] * K::TX_LINEAR[y0]) >> K::TX_FP;
+                dy += (c[6] * K::TX_SQUARE[y0]) >> K::TX_FP;
+                dy += (c[7] * K::TX_LINEAR[x]) >> K::TX_FP;
+                dy = std::clamp(dy >> (K::TX_FP + 1), -128, 127);
+
+                int32_t dx = c[1] * (1 << (K::TX_FP + 1));
+                dx += (c[2] * K::TX_LINEAR[x]) >> K::TX_FP;
+                dx += (c[3] * K::TX_SQUARE[x]) >> K::TX_FP;
+                dx += (c[7] * K::TX_LINEAR[y0]) >> K::TX_FP;
+                dx = std::clamp(dx >> (K::TX_FP + 1), -128, 127);
+
+                for(int32_t e = 0; e < 16; e++) {
+
+                    const int32_t xl = e / 4 - 2;
+                    const int32_t yl = e % 4 - 2;
+
+                    int32_t element = 16 * (1 << K::TX_FP) - (group % 2 == 0 ? 1 << K::TX_FP : 0);
+                    element += (dx >> 2) + ((xl * dx) >> 1);
+                    element += (dy >> 2) + ((yl * dy) >> 1);
+                    element >>= K::TX_FP;
+
+                    if(element >= K::TX_ELEMENT_MAX)
+                        element = K::TX_INVALID;
+
+                    delays[(y * K::GROUPS_X + x) * 16 + e] = int16_t((group & ~1) + element);
+
+                }
+            }
+        }
+
+        return delays;
 
     }
 
@@ -222,8 +280,8 @@ struct RxDelays {
 template<TransducerParams usparams>
 struct DecompRxDelays {
 
-    Delays delays;  ///< Delay for every element
-    Phases phases;  ///< Phase for every element, radian
+    QuantDelays delays;     ///< Delay for every element in Rx Delay Res Units
+    QuantPhases phases;     ///< Dynamic Curve every element follows (0 - 7)
 
 };
 
@@ -246,9 +304,9 @@ public:
      * \param[in] y: Y in 3-D Space
      * \param[in] z: Z in 3-D Space
      * 
-     * \return RxCoeffs: The Taylor Coefficients for reception, calculated at compile time
+     * \return RxCoeffs: The Taylor Coefficients for reception
      */
-    static consteval RxCoeffs CompressTaylor(const double x, const double y, const double z) noexcept {
+    static constexpr RxCoeffs CompressTaylor(const double x, const double y, const double z) noexcept {
 
         if (x == 0 && y == 0 && z == 0)
             return RxCoeffs{};
@@ -313,16 +371,52 @@ public:
     }
 
     /**
-     * \brief Decompresses the Taylor Coefficients into Delays and Phases
+     * \brief Decompresses the Taylor Coefficients into the Delays and Dynamic Curves the ASIC Receives With
      * 
-     * \note See the MATLAB script for details
-     * \todo Implement this, test it, and verify it
+     * \note Integer for Integer the Same as DelayUncompressionRxAsic in the Oldelft MATLAB Scripts, \ref TaylorKernel::UncompressRx is the Fast Version
      * 
      * \param[in] coeffs: Taylor Polynomial
      * 
-     * \return RxDelays: The uncompressed coefficients
+     * \return DecompRxDelays: The Delays in Rx Delay Res Units and the Curves, in the ASIC's Element Order
      */
-    static consteval RxDelays<usparams> UncompressTaylor(const RxCoeffs coeffs) noexcept;
+    static constexpr DecompRxDelays<usparams> UncompressTaylor(const RxCoeffs& coeffs) noexcept {
+
+        using K = TaylorKernel;
+
+        DecompRxDelays<usparams> out{};
+        const int32_t c[10] = { coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4], coeffs[5], coeffs[6], coeffs[7], coeffs[8], coeffs[9] };
+
+        const int32_t base = 14 * 8 + (c[7] >> 2) + (c[8] >> 2) + 4;
+
+        for(int32_t y = 0; y < K::GROUPS_Y; y++) {
+
+            const int32_t y0 = y + K::GROUP_OFFSET_Y;
+
+            for(int32_t x = 0; x < K::GROUPS_X; x++) {
+
+                const int32_t dx = (c[0] + ((c[1] * K::RX_LINEAR[x]) >> 5) + ((c[2] * K::RX_SQUARE[x]) >> 5)) >> 1;
+                const int32_t dy = (c[3] + ((c[4] * K::RX_LINEAR[y0]) >> 5) + ((c[5] * K::RX_SQUARE[y0]) >> 5) + ((c[6] * K::RX_LINEAR[x]) >> 5)) >> 1;
+
+                for(int32_t e = 0; e < 16; e++) {
+
+                    const int32_t xl = e / 4 - 2;
+                    const int32_t yl = e % 4 - 2;
+                    const int32_t i = (y * K::GROUPS_X + x) * 16 + e;
+
+                    // 8 for the rounding, centering and overflow margin, then take the center of the curves back off
+                    const int32_t assign = 8 * 8 + (dx >> 2) + ((dx * xl) >> 1) + (dy >> 2) + ((dy * yl) >> 1);
+                    const int32_t phase = std::clamp((assign - 4 * 8) >> 3, 0, K::RX_CURVES - 1);
+
+                    out.phases[i] = int8_t(phase);
+                    out.delays[i] = int16_t((base + ((c[7] * xl) >> 1) + ((c[8] * yl) >> 1) + (phase * 2 - (K::RX_CURVES - 1)) * c[9]) >> 3);
+
+                }
+            }
+        }
+
+        return out;
+
+    }
 
     /**
      * \brief Calculates the Necessary Data to Receive From a Range On a ray in a direction
@@ -368,15 +462,43 @@ public:
     }
     
     /**
-     * \brief Takes Dynamic Compression Data and Gets Delays From it
+     * \brief Takes Dynamic Compression Data and Gets the Delays the ASIC Applies at a Point in Time
      * 
-     * \note Implemented based on the Oldeft MATLAB Scripts
-     * \todo Actually Implement this
+     * \note Implemented based on UncompressRxDyn in the Oldeft MATLAB Scripts, the Curves Have 4 Times the Static Resolution
      * 
+     * \param[in] dynrx: The Coefficients and the Master Curve
+     * \param[in] t_s: Time Since the Transmission in Seconds
+     * \param[in] runtime: The RunRxTime Setting of the ASIC, in 40ns Steps
+     * \return DecompRxDelays: The Delays in Quarter Rx Delay Res Units and the Curve Each Element Follows
      */
-    static consteval void UncompressTaylorDyn(const DynRxData dynrx) {
+    static constexpr DecompRxDelays<usparams> UncompressTaylorDyn(const DynRxData& dynrx, const double t_s, const uint8_t runtime) noexcept {
 
-        
+        constexpr double step_s = 2.56e-6;          // one step of the master curve
+        constexpr double runtime_step_s = 40e-9;    // one step of RunRxTime
+        constexpr int32_t multiplier[8] = { 7, 5, 3, 1, -1, -3, -5, -7 };
+
+        // integrate the slope over the segments up to t_s, constant before the start and after the end
+        double start = runtime * runtime_step_s;
+        double curve = 0.0;
+
+        for(size_t i = 0; i < dynrx.slope.size() && t_s >= start; i++) {
+
+            const double end = start + dynrx.duration[i] * step_s;
+            curve += dynrx.slope[i] * (gcem::min(t_s, end) - start) / step_s;
+            start = end;
+
+        }
+
+        DecompRxDelays<usparams> out = UncompressTaylor(dynrx.coeffs);
+        for(size_t i = 0; i < out.delays.size(); i++) {
+
+            const int32_t m = multiplier[out.phases[i]];
+            const int32_t dynamic = int32_t(gcem::floor(gcem::abs(m) * curve / 256.0)) * (m < 0 ? -1 : 1);
+            out.delays[i] = int16_t(out.delays[i] * 4 + dynamic);
+
+        }
+
+        return out;
 
     }
 
@@ -390,7 +512,7 @@ public:
      * \param[in] y_deg: The angle from the XY plane
      * \return RxDelays: The Appropiate Taylor Polynomial data for receiving from the x and y degrees ray direction 
      */
-    static consteval RxDelays<usparams> CalculateDelays(const double x_deg, const double y_deg) noexcept {
+    static constexpr RxDelays<usparams> CalculateDelays(const double x_deg, const double y_deg) noexcept {
 
         const double x_rad = x_deg * GCEM_PI / 180.0;
         const double y_rad = y_deg * GCEM_PI / 180.0;
@@ -438,7 +560,7 @@ private:
      * 
      * \return std::pair, the min and max
      */
-    static consteval std::pair<double, double> GetAssignmentMinMax(const double coeffs[7], const uint8_t scale) {
+    static constexpr std::pair<double, double> GetAssignmentMinMax(const double coeffs[7], const uint8_t scale) {
 
         (void)coeffs;
         (void)scale;
@@ -449,28 +571,136 @@ private:
 
 };
 
+/// One Beam of Taylor Scan Data, Points Into the \ref ScanData Tables
+struct TaylorBeam {
+
+    const TxCoeffs& txcoeffs;           ///< Tx Taylor Coefficients
+    const RxCoeffs& rxcoeffs;           ///< Rx Taylor Coefficients
+    double txoffset;                    ///< Transmission Offset in S
+    const GroupDelays& rxgroupdelays;   ///< Group Delays for Reception
+
+};
+
+/// One Beam of Delay Scan Data, Points Into the \ref ScanData Tables
+struct DelayBeam {
+
+    const QuantDelays& txdelays;        ///< Tx Delays in Tx Delay Res Units
+    const QuantRxDelays& rxdelays;      ///< Rx Delays in Rx Delay Res Units
+    const GroupDelays& rxgroupdelays;   ///< Group Delays for Reception
+
+};
+
+/**
+ * \brief The Scan Tables Filled in Taylor Mode, Each Field is its Own Array Over the Beams
+ * 
+ * \tparam N: Number of Beams in the Scan
+ */
+template<size_t N>
+struct TaylorScanData {
+
+    std::array<TxCoeffs, N> txcoeffs;           ///< Tx Taylor Coefficients Over the Scan Area
+    std::array<RxCoeffs, N> rxcoeffs;           ///< Rx Taylor Coefficients Over the Scan Area
+    std::array<double, N> txoffsets;            ///< Transmissions Offsets Over the Scan Area
+    std::array<GroupDelays, N> rxgroupdelays;   ///< Group Delays over the scan area for reception
+
+    /**
+     * \brief Get Everything Needed to Fire a Beam
+     * 
+     * \param[in] beam: The Beam Index, i + j * x_steps
+     * \return TaylorBeam: View of the Beam
+     */
+    constexpr TaylorBeam GetBeam(const size_t beam) const noexcept { return { txcoeffs[beam], rxcoeffs[beam], txoffsets[beam], rxgroupdelays[beam] }; }
+
+};
+
+/**
+ * \brief The Scan Tables Filled in Delay Mode, the Delays are Stored Quantized, the Way the ASIC Takes Them
+ * 
+ * \tparam N: Number of Beams in the Scan
+ */
+template<size_t N>
+struct DelayScanData {
+
+    std::array<QuantDelays, N> txdelays;        ///< Tx Delays Over that Scan Area
+    std::array<QuantRxDelays, N> rxdelays;      ///< Rx Delays Over the Scan Area
+    std::array<GroupDelays, N> rxgroupdelays;   ///< Group Delays over the scan area for reception
+
+    /**
+     * \brief Get Everything Needed to Fire a Beam
+     * 
+     * \param[in] beam: The Beam Index, i + j * x_steps
+     * \return DelayBeam: View of the Beam
+     */
+    constexpr DelayBeam GetBeam(const size_t beam) const noexcept { return { txdelays[beam], rxdelays[beam], rxgroupdelays[beam] }; }
+
+};
+
+/**
+ * \brief What the ASIC Makes of the Taylor Scan Tables, Every Beam Decompressed, in the ASIC's Element Order
+ * 
+ * \tparam N: Number of Beams in the Scan
+ */
+template<size_t N>
+struct DecompScanData {
+
+    std::array<QuantDelays, N> txdelays;    ///< Tx Delays Over the Scan Area in Tx Delay Res Units
+    std::array<QuantDelays, N> rxdelays;    ///< Rx Delays Over the Scan Area in Rx Delay Res Units
+    std::array<QuantPhases, N> rxphases;    ///< Dynamic Rx Curves Over the Scan Area
+
+};
+
 /**
  * \brief All of the Data that is Needed to Sweep over a given 3-D Volume defined By the template Parameters
  * 
+ * Only the Tables the Mode Uses Exist, Taylor Mode is Around 40 Bytes a Beam and Delay Mode Around 3 KB a Beam
+ * 
  * \tparam params: Controller Related Parameters including x and y steps 
  * \tparam usparams: Physical Parameters for the Ultrasound 
  */
 template<ControllerParams params, TransducerParams usparams>
-struct ScanData {
+struct ScanData: std::conditional_t<params.usedelays, DelayScanData<size_t(params.x_steps) * params.y_steps>, TaylorScanData<size_t(params.x_steps) * params.y_steps>> {
 
-    std::array<Delays, params.x_steps * params.y_steps> txdelays;               ///< Tx Delays Over that Scan Area
-    std::array<RxDelays<usparams>, params.x_steps * params.y_steps> rxdelays;   ///< Rx Delays Over the Scan Area
-    std::array<TxCoeffs, params.x_steps * params.y_steps> txcoeffs;             ///< Tx Taylor Coefficients Over the Scan Area
-    std::array<RxCoeffs, params.x_steps * params.y_steps> rxcoeffs;             ///< Rx Taylor Coefficients Over the Scan Area
+    /// Number of Beams in the Scan
+    static constexpr size_t BEAMS = size_t(params.x_steps) * params.y_steps;
 
-    std::array<double, params.x_steps * params.y_steps> txoffsets;              ///< Transmissions Offsets Over the Scan Area
-    std::array<GroupDelays, params.x_steps * params.y_steps> rxgroupdelays;     ///< Group Delays over the scan area for reception
+};
+
+/// Where a Beam of the Scan Points and Where it Focuses on Transmission
+struct BeamGeometry {
 
-    std::array<DynRxData, params.x_steps * params.y_steps> dynrx;               ///< Dynamic RX Curves for the whole scan area
-    std::array<Phases, params.x_steps * params.y_steps> phases;                 ///< Phases over the Scan Volume
+    double x_deg;   ///< The Beam Angle in the X Direction
+    double y_deg;   ///< The Beam Angle in the Y Direction
+    double txx;     ///< X of the Transmit Focus in Meters
+    double txy;     ///< Y of the Transmit Focus in Meters
+    double txz;     ///< Z of the Transmit Focus in Meters
 
 };
 
+/**
+ * \brief Works Out Where a Beam of the Scan Points, Shared by the Compile Time and Runtime Scan Calculations so They Can't Drift Apart
+ * 
+ * \param[in] params: The Scan Area and Focus
+ * \param[in] i: The X Step
+ * \param[in] j: The Y Step
+ * \return BeamGeometry: The Angles and the Transmit Focus
+ */
+constexpr BeamGeometry GetBeamGeometry(const ControllerParams& params, const int i, const int j) noexcept {
+
+    const double x_deg = (params.x_max_deg - params.x_min_deg) * i / params.x_steps + params.x_min_deg;
+    const double y_deg = (params.y_max_deg - params.y_min_deg) * j / params.y_steps + params.y_min_deg;
+    const double x_rad = GCEM_PI * x_deg / 180.0;
+    const double y_rad = GCEM_PI * y_deg / 180.0;
+
+    const double A = gcem::sqrt(1 - gcem::pow(gcem::sin(x_rad), 2) * gcem::pow(gcem::sin(y_rad), 2));
+    return {
+        x_deg, y_deg,
+        params.focus_tx * gcem::sin(x_rad) * gcem::cos(y_rad) / A,
+        params.focus_tx * gcem::sin(y_rad) * gcem::sin(x_rad) / A,
+        params.focus_tx * gcem::cos(x_rad) * gcem::cos(y_rad) / A
+    };
+
+}
+
 /**
  * \brief Controller that Manages both RX and TX
  * 
@@ -492,48 +722,71 @@ public:
      */
     static consteval ScanData<params, usparams> PreCalcScanData() noexcept {
 
-        ScanData<params, usparams> data;
+        ScanData<params, usparams> data{};
 
-        for(int i = 0; i < params.x_steps; i++) {
-            for(int j = 0; j < params.y_steps; j++) {
+        for(int i = 0; i < params.x_steps; i++)
+            for(int j = 0; j < params.y_steps; j++)
+                CalcBeam(data, i, j);
 
-                double x_deg = (params.x_max_deg - params.x_min_deg) * i / params.x_steps + params.x_min_deg;
-                double y_deg = (params.y_max_deg - params.y_min_deg) * j / params.y_steps + params.y_min_deg;
-                double x_rad = GCEM_PI * x_deg / 180.0;
-                double y_rad = GCEM_PI * y_deg / 180.0;
+        return data;
 
-                double A = gcem::sqrt(1 - gcem::pow(gcem::sin(x_rad), 2) * gcem::pow(gcem::sin(y_rad), 2));
-                double txx = params.focus_tx * gcem::sin(x_rad) * gcem::cos(y_rad) / A;
-                double txy = params.focus_tx * gcem::sin(y_rad) * gcem::sin(x_rad) / A;
-                double txz = params.focus_tx * gcem::cos(x_rad) * gcem::cos(y_rad) / A;
+    }
 
-                double rxr = params.focus_rx == 0 ? gcem::pow(10, 6): params.focus_rx;
-                
-                double rxx = rxr * gcem::sin(x_rad) * gcem::cos(y_rad) / A;
-                double rxy = rxr * gcem::sin(y_rad) * gcem::cos(x_rad) / A;
-                double rxz = rxr * gcem::cos(x_rad) * gcem::cos(y_rad) / A;
-                
-                if constexpr (!params.usedelays) {
+    /**
+     * \brief Calculates the Scan Data at Runtime With the Same Code as \ref PreCalcScanData, the Beams are Spread Over a Thread Pool
+     * 
+     * \note Only Checked Bit for Bit Against \ref PreCalcScanData on a Small Grid, and Only Identical if Floating Point is
+     * Strict, no -ffast-math and no FMA Contraction
+     * 
+     * \param[in] pool: Threads to Calculate the Beams on
+     * \return std::unique_ptr<ScanData>: Enough Data to go over the whole scan volume, too big for the stack
+     */
+    static std::unique_ptr<ScanData<params, usparams>> CalcScanData(ThreadPool& pool) {
 
-                    data.txcoeffs[i + j * params.x_steps] = TXController<params.txparams, usparams>::CompressTaylor(txx, txy, txz, 0).coeffs;
-                    data.rxcoeffs[i + j * params.x_steps] = RXController<params.rxparams, usparams>::CompressTaylor(txx, txy, txz);
-                    data.txoffsets[i + j * params.x_steps] = TXController<params.txparams, usparams>::CompressTaylor(txx, txy, txz, 0).beamoffset_s;
-                    data.rxgroupdelays[i + j * params.x_steps] = RXController<params.rxparams, usparams>::CalculateDelays(x_deg, y_deg).groupdelays;
+        auto data = std::make_unique<ScanData<params, usparams>>();
 
-                }
-                else {
-
-                    data.txdelays[i + j * params.x_steps] = TXController<params.txparams, usparams>::CalculateDelays(txx, txy, txz);
-                    data.rxdelays[i + j * params.x_steps] = RXController<params.rxparams, usparams>::CalculateDelays(x_deg, y_deg);
-                    
-                }
-            }
-        }
+        pool.ParallelFor(size_t(params.x_steps) * params.y_steps, [&data](const size_t beam) {
+            CalcBeam(*data, int(beam % params.x_steps), int(beam / params.x_steps));
+        });
 
         return data;
 
     }
 
+    /**
+     * \brief Calculates the Scan Data at Runtime on a Pool With a Thread per Core
+     * 
+     * \return std::unique_ptr<ScanData>: Enough Data to go over the whole scan volume
+     */
+    static std::unique_ptr<ScanData<params, usparams>> CalcScanData() {
+
+        ThreadPool pool;
+        return CalcScanData(pool);
+
+    }
+
+    /**
+     * \brief Decompresses Every Beam of Taylor Scan Data the Way the ASIC Does, the Beams are Spread Over a Thread Pool
+     * 
+     * \param[in] data: The Scan Data to Decompress, Has to be Taylor Scan Data
+     * \param[in] pool: Threads to Decompress the Beams on
+     * \return std::unique_ptr<DecompScanData>: The Delays the Hardware Really Uses, too big for the stack
+     */
+    static std::unique_ptr<DecompScanData<ScanData<params, usparams>::BEAMS>> UncompressScanData(const ScanData<params, usparams>& data, ThreadPool& pool) {
+
+        static_assert(!params.usedelays, "Only Taylor Scan Data is Compressed");
+
+        auto out = std::make_unique<DecompScanData<ScanData<params, usparams>::BEAMS>>();
+
+        pool.ParallelFor(ScanData<params, usparams>::BEAMS, [&data, &out](const size_t beam) {
+            TaylorKernel::UncompressTx(data.txcoeffs[beam], out->txdelays[beam]);
+            TaylorKernel::UncompressRx(data.rxcoeffs[beam], out->rxdelays[beam], out->rxphases[beam]);
+        });
+
+        return out;
+
+    }
+
     /**
      * \brief 
      * 
@@ -578,6 +831,37 @@ public:
 
 private:
 
+    /**
+     * \brief Calculates One Beam of the Scan, Shared by the Compile Time and the Runtime Versions so They Can't Drift Apart
+     * 
+     * \param[out] data: The Scan Data to Write the Beam to
+     * \param[in] i: The X Step
+     * \param[in] j: The Y Step
+     */
+    static constexpr void CalcBeam(ScanData<params, usparams>& data, const int i, const int j) noexcept {
+
+        const BeamGeometry beam = GetBeamGeometry(params, i, j);
+        const double x_deg = beam.x_deg, y_deg = beam.y_deg;
+        const double txx = beam.txx, txy = beam.txy, txz = beam.txz;
+
+        if constexpr (!params.usedelays) {
+
+            data.txcoeffs[i + j * params.x_steps] = TXController<params.txparams, usparams>::CompressTaylor(txx, txy, txz, 0).coeffs;
+            data.rxcoeffs[i + j * params.x_steps] = RXController<params.rxparams, usparams>::CompressTaylor(txx, txy, txz);
+            data.txoffsets[i + j * params.x_steps] = TXController<params.txparams, usparams>::CompressTaylor(txx, txy, txz, 0).beamoffset_s;
+            data.rxgroupdelays[i + j * params.x_steps] = RXController<params.rxparams, usparams>::CalculateDelays(x_deg, y_deg).groupdelays;
+
+        }
+        else {
+
+            const auto rxdelays = RXController<params.rxparams, usparams>::CalculateDelays(x_deg, y_deg);
+            QuantizeDelays(TXController<params.txparams, usparams>::CalculateDelays(txx, txy, txz), data.txdelays[i + j * params.x_steps]);
+            QuantizeDelays(rxdelays.delays, data.rxdelays[i + j * params.x_steps]);
+            data.rxgroupdelays[i + j * params.x_steps] = rxdelays.groupdelays;
+
+        }
+    }
+
     TXController<params.txparams, usparams> tx;    ///< Transmssion Controller
     RXController<params.rxparams, usparams> rx;    ///< Receiving Controller
     
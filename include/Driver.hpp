@@ -13,21 +13,20 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <array>
 #include <iostream>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <optional>
 
-#include "Parameters.hpp"
-
-#ifdef _WIN32 || defined(_WIN64)
-#include <windows.h>
-
-/**
- * \brief  Type definition for the dll imported function for the asic call wrapper
- * \note   From Oldelft
- */
-typedef int (_stdcall *f_dllfunction)(char *inString, char *outString);
+#include <memory>
 
-#endif
+#include "Parameters.hpp"
+#include "CommandQueue.hpp"
+#include "Transport.hpp"
+#include "Result.hpp"
 
 namespace SoundCath {
 
@@ -79,40 +78,153 @@ struct DriverError {
 
 };
 
+/**
+ * \brief Throws the Exception for an Error Mask, Lets a \ref Result Holding Driver Errors Throw
+ * \throws DriverException: Always, for the First Error Set, \ref DriverError::FAILED if None are
+ * \param[in] error: The Error Mask
+ */
+[[noreturn]] void ThrowError(const DriverError::Code error);
+
+/// A Value or the Driver Error Mask That Stopped it
+template<typename T = void>
+using DriverResult = Result<T, DriverError::Code>;
+
 /**
  * \brief  ASIC interfacer class
  * \note   A wrapper for the Oldeft API
+ * 
+ * Commands can be sent synchronously with \ref Send and \ref Query, or submitted to a bounded queue with \ref SendAsync
+ * that is drained in order by a dedicated IO thread. A synchronous call waits for every command submitted before it, 
+ * so commands always reach the device in the order they were issued.
+ *
+ * Callbacks Run on the IO Thread, While the Command That Called Them Back Still Counts as Queued. From There a
+ * Synchronous Call Would Wait on Itself and \ref SendAsync on a Full Queue Would Wait Forever, so Both Throw a
+ * \ref DriverException Instead, \ref QueryIfIdle Just Comes Back Empty.
+ * 
+ * The Driver doesn't know how the commands get to the box, that is up to the \ref Transport it owns.
  */
 class Driver {
 
 public:
 
+    /// The Max Number of Asynchronous Commands Waiting to be Sent Before Submitters Block
+    static constexpr size_t QUEUE_DEPTH = 64;
+
     /**
-     * \brief Construct a new Driver object
+     * \brief Construct a new Driver object on the Platform Default Transport, Starts the IO Thread
      * 
      */
     Driver();
 
     /**
-     * \brief Destroy the Driver object
+     * \brief Construct a new Driver object on a Given Transport, Starts the IO Thread
+     * 
+     * \param[in] transport: What Carries the Commands to the Box, Owned by the Driver From Here On
+     */
+    explicit Driver(std::unique_ptr<Transport> transport);
+
+    /**
+     * \brief Destroy the Driver object, Drains the Queue and Stops the IO Thread
      * 
      */
     ~Driver();
 
     /**
      * \brief Sends A Command String and Returns what The Interface Sent Back
-     * \throws DriverException: If there are Issues on the Backend
+     * \throws DriverException: If there are Issues on the Backend, or if Called From a Callback
      * \param[in] command: Command To Send the Device
      * \return std::string: What The Device Sent Back
      */
     std::string Query(const std::string& command) const;
 
+    /**
+     * \brief Sends A Command and Parses the Response Straight Out of the Output Buffer, Nothing is Copied
+     * 
+     * The IO Lock is Held Until the Parser Returns, so Neither the IO Thread nor Another Query can Overwrite the
+     * Response While it is Being Read
+     * \throws DriverException: If the Interface Returns an Error or if Called From a Callback, or Whatever the Parser Throws
+     * \param[in] command: Null Terminated Command To Send
+     * \param[in] parse: Called With a View of the Response, Must Not Keep it
+     * \return auto: What the Parser Returns
+     */
+    template<typename Parser>
+    auto Query(const char* command, Parser&& parse) const {
+
+        NotFromCallback();
+        queue.WaitIdle();
+        std::scoped_lock<std::mutex> guard(iolock);
+        Dispatch(command);
+        return parse(std::string_view(outbuffer.data()));
+
+    }
+
+    /**
+     * \brief Sends A Command and Returns the Response Only if the Interface is Idle, Never Waits on Other Commands
+     * 
+     * For Background Work That Shouldn't Get in the Way, if Anything is Queued or Another Thread is Talking to the Box
+     * Nothing is Sent. Something Queued Right After the Check Waits for at Most This One Round Trip.
+     * \throws DriverException: If the Interface Returns an Error
+     * \param[in] command: Command To Send the Device
+     * \return std::optional<std::string>: What The Device Sent Back, Empty if the Interface was Busy
+     */
+    std::optional<std::string> QueryIfIdle(const std::string& command) const;
+
     /**
      * \brief Sends A Command String To The Interface Box
      * \throws DriverException: If there are any issues On the Backend
      * \param[in] command: Command String To Send
      */
-    void Send(const std::string& command) const;
+    void Send(const std::string& command) const { Send(command.c_str()); }
+
+    /**
+     * \brief Sends A Null Terminated Command Straight From a Caller Owned Buffer, Nothing is Copied or Allocated
+     * \throws DriverException: If there are any issues On the Backend
+     * \param[in] command: Null Terminated Command String To Send
+     */
+    void Send(const char* command) const;
+
+    /**
+     * \brief Same as \ref Send but Returns the Error Mask Instead of Throwing
+     * 
+     * For Hot Paths That Retry on Errors Like a Busy ASIC, Nothing is Thrown or Logged as an Error, the Caller Decides
+     * \throws DriverException: Only if Called From a Callback
+     * \param[in] command: Null Terminated Command String To Send
+     * \return DriverResult<>: Every Error Flag the Interface Returned, Empty on Success
+     */
+    DriverResult<> TrySend(const char* command) const;
+
+    /// Same as \ref TrySend(const char*) const
+    DriverResult<> TrySend(const std::string& command) const { return TrySend(command.c_str()); }
+
+    /**
+     * \brief Queues a Command to be Sent by the IO Thread, Blocks Only if the Queue is Full
+     * \throws DriverException: If the Driver is Shutting Down, or if Called From a Callback
+     * \param[in] command: Command String to Send
+     * \return std::future<std::string>: Resolves to the Response, or Holds the DriverException on Failure
+     */
+    std::future<std::string> SendAsync(std::string command);
+
+    /**
+     * \brief Queues a Command to be Sent by the IO Thread and Calls Back When it Completes
+     * \note The Callback Runs on the IO Thread, Keep it Short and Don't Call Back Into the Driver From it
+     * \throws DriverException: If the Driver is Shutting Down, or if Called From a Callback
+     * \param[in] command: Command String to Send
+     * \param[in] callback: Called With the Response and the Driver Return Code
+     */
+    void SendAsync(std::string command, CommandCallback callback);
+
+    /**
+     * \brief Blocks Until Every Queued Command Has Been Sent
+     * \throws DriverException: If Called From a Callback
+     */
+    void Flush() const { NotFromCallback(); queue.WaitIdle(); }
+
+    /**
+     * \brief Get the Number of Asynchronous Commands Queued or in Flight
+     * 
+     * \return size_t: Unfinished Commands
+     */
+    size_t Pending() const noexcept { return queue.Pending(); }
 
     /**
      * \brief Receives the Last Output to an External String
@@ -142,14 +254,52 @@ public:
      */
     std::string GetOutString() const noexcept { return std::string(outbuffer.data()); }
 
+    /**
+     * \brief Get a View of the Output Buffer, Nothing is Copied
+     * \note Only Valid Until the Next Command is Sent, and Nothing Stops Another Thread From Sending One, Parse With
+     * \ref Query(const char*, Parser&&) const Instead
+     * 
+     * \return std::string_view: The Response From the Last Command
+     */
+    std::string_view GetOutView() const noexcept { return std::string_view(outbuffer.data()); }
+
 private:
 
-    #ifdef _WIN32
-    f_dllfunction asic_call_parse;      ///< Function pointer from the DLL
-    HINSTANCE dll;                      ///< Handle for the DLL
-    #endif                              
+    /**
+     * \brief Hands a Command to the Interface and Writes the Response to the Output Buffer
+     * \note The IO Lock Must be Held
+     * \param[in] command: Null Terminated Command to Send
+     * \return uint32_t: The Raw Return Code, see \ref DriverError::Code
+     */
+    uint32_t Transfer(const char* command) const;
+
+    /**
+     * \brief Transfers a Command and Throws if the Interface Returned an Error
+     * \note The IO Lock Must be Held
+     * \throws DriverException: If the Interface Returns an Error
+     * \param[in] command: Null Terminated Command to Send
+     */
+    void Dispatch(const char* command) const;
+
+    /**
+     * \brief Throws Before a Call That Waits on the Queue Runs on the IO Thread, Where it Would Wait on Itself
+     * \throws DriverException: If Called From the IO Thread
+     */
+    void NotFromCallback() const;
+
+    /**
+     * \brief Drains the Command Queue Until it is Closed, Runs on its Own Thread
+     * 
+     */
+    void IOThread();
+
+    std::unique_ptr<Transport> transport;   ///< Carries the Commands to the Box
+
+    mutable std::array<char, UINT16_MAX> outbuffer;    ///< Data Buffer For the output data, 65kB wide     
 
-    std::array<char, UINT16_MAX> outbuffer;    ///< Data Buffer For the output data, 65kB wide     
+    mutable CommandQueue queue{QUEUE_DEPTH};    ///< Commands Waiting for the IO Thread
+    mutable std::mutex iolock;                  ///< Serializes Access to the Interface and the Output Buffer
+    std::thread iothread;                       ///< Sends the Queued Commands
 
 };
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <exception>
+#include <string>
 
 #include "ASIC.hpp"
 #include "FPGA.hpp"
@@ -135,4 +136,34 @@ private:
 
 };
 
+/**
+ * \brief An Exception for a Bad Parameter File, Says Where in the File the Problem is
+ * 
+ */
+class ConfigException: public std::exception {
+
+public:
+
+    /**
+     * \brief Construct a new Config Exception object
+     * 
+     * \param[in] message: What Went Wrong and Where
+     */
+    ConfigException(std::string message);
+
+    virtual ~ConfigException() {}
+
+    /**
+     * \brief Gets the Error Message
+     * 
+     * \return const char*: The Error Message
+     */
+    const char* what() const noexcept override;
+
+private:
+
+    std::string message;    ///< The Error Message, Built at Runtime so it is Owned
+
+};
+
 }
\ No newline at end of file
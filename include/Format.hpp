@@ -0,0 +1,146 @@
+/**
+ * \file Format.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Fast Text Formatters and Parsers for Delays, Used to Build the Fire and Queue Commands and Read Them Back
+ * \version 0.1
+ * \date 2022-05-06
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "ASIC.hpp"
+
+#include <cstdint>
+#include <array>
+#include <string_view>
+#include <tuple>
+#include <limits>
+#include <algorithm>
+
+namespace SoundCath {
+
+/// Most Characters a Single Formatted Delay Takes, a Sign and 4 Digits
+constexpr size_t DELAY_WIDTH = 5;
+
+/// Delays are Clamped to This Before Formatting so They Always Fit in \ref DELAY_WIDTH, Way Past Anything the ASIC Takes
+constexpr int16_t DELAY_LIMIT = 9999;
+
+/**
+ * \brief Rounds Delays to the Nearest Integer Delay Unit, Clamped to +-\ref DELAY_LIMIT and to What T Holds
+ * \note Written so the Compiler Vectorizes it, Keep it Branch Free. constexpr so the Scan Data can be Quantized at Compile Time
+ * \tparam T: The Integer Type to Quantize to
+ * \param[in] delays: The Delays in ASIC Delay Units
+ * \param[out] quantized: The Rounded Delays
+ */
+template<typename T, size_t N>
+constexpr void QuantizeDelays(const std::array<double, N>& delays, std::array<T, N>& quantized) noexcept {
+
+    constexpr double low = std::max(-double(DELAY_LIMIT), double(std::numeric_limits<T>::min()));
+    constexpr double high = std::min(double(DELAY_LIMIT), double(std::numeric_limits<T>::max()));
+
+    for(size_t i = 0; i < N; i++) {
+
+        const double clamped = std::clamp(delays[i], low, high);
+        quantized[i] = T(clamped + (clamped < 0.0 ? -0.5 : 0.5)); // round half away from zero, same as std::round
+
+    }
+}
+
+/**
+ * \brief Writes Delays as Comma Separated Integers, Rounded to the Nearest Delay Unit
+ * \note No Null Terminator is Written
+ * \param[in] delays: The Delays in ASIC Delay Units
+ * \param[out] out: Where to Write, Needs Room for 1024 * (\ref DELAY_WIDTH + 1) Characters
+ * \return char*: One Past the Last Character Written
+ */
+char* FormatDelays(const Delays& delays, char* out) noexcept;
+
+/**
+ * \brief Writes Quantized Delays as Comma Separated Integers
+ * \note No Null Terminator is Written
+ * \param[in] delays: The Quantized Delays
+ * \param[out] out: Where to Write, Needs Room for 1024 * (\ref DELAY_WIDTH + 1) Characters
+ * \return char*: One Past the Last Character Written
+ */
+char* FormatDelays(const QuantDelays& delays, char* out) noexcept;
+
+/**
+ * \brief Writes Quantized Rx Delays as Comma Separated Integers
+ * \note No Null Terminator is Written
+ * \param[in] delays: The Quantized Delays
+ * \param[out] out: Where to Write, Needs Room for 1024 * 5 Characters
+ * \return char*: One Past the Last Character Written
+ */
+char* FormatDelays(const QuantRxDelays& delays, char* out) noexcept;
+
+/**
+ * \brief Writes Group Delays as Comma Separated Integers
+ * \note No Null Terminator is Written
+ * \param[in] delays: The Group Delays
+ * \param[out] out: Where to Write, Needs Room for 16 * 5 Characters
+ * \return char*: One Past the Last Character Written
+ */
+char* FormatDelays(const GroupDelays& delays, char* out) noexcept;
+
+/**
+ * \brief Parses a Comma Separated List of Integer Delays, the Inverse of \ref FormatDelays
+ *
+ * \param[in] list: The Delays, Whitespace is Allowed Around the Values
+ * \param[out] delays: Filled in Place, Only Valid if the Parse Succeeded
+ * \return true: If Exactly 1024 Delays were Parsed
+ * \return false: If the List is Malformed, Short or Long
+ */
+bool ParseDelays(std::string_view list, Delays& delays) noexcept;
+
+/**
+ * \brief Parses the Response to ReadTxDelays, "ReadTxDelays:RESULT[ASIC 0]: 4,5,6,..."
+ * \throws DriverException: USB_RECEIVE if the Framing is Wrong or the Delays are Malformed
+ * \param[in] response: The Full Response From the Driver
+ * \param[out] delays: The Tx Delays, Filled in Place
+ */
+void ParseTxDelays(std::string_view response, Delays& delays);
+
+/**
+ * \brief Parses the Response to ReadRxDelays, "ReadRxDelays:RESULT[ASIC 0]: 14/4 13/5 ..." Where Each Entry is Delay/Clock Phase
+ * \throws DriverException: USB_RECEIVE if the Framing is Wrong or the Delays are Malformed
+ * \param[in] response: The Full Response From the Driver
+ * \param[out] delays: The Rx Delays, Filled in Place
+ * \param[out] phases: The Rx Clock Phases, Filled in Place
+ */
+void ParseRxDelays(std::string_view response, Delays& delays, Phases& phases);
+
+/**
+ * \brief Formats Delays Into Storage it Owns, so They can be Handed to fmt as a string_view
+ *
+ * \tparam Array: The Delay Type, Anything \ref FormatDelays Takes
+ */
+template<typename Array>
+class DelayString {
+
+public:
+
+    /**
+     * \brief Formats the Delays
+     *
+     * \param[in] delays: The Delays to Format
+     */
+    explicit DelayString(const Array& delays) noexcept: size(FormatDelays(delays, text.data()) - text.data()) {}
+
+    /**
+     * \brief Get the Formatted Delays
+     *
+     * \return std::string_view: The Comma Separated Delays
+     */
+    std::string_view View() const noexcept { return std::string_view(text.data(), size); }
+
+private:
+
+    std::array<char, std::tuple_size_v<Array> * (DELAY_WIDTH + 1)> text;   ///< The Formatted Text
+    size_t size;                                                            ///< How Much of the Text is Used
+
+};
+
+}
@@ -0,0 +1,159 @@
+/**
+ * \file Kernels.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Vectorized Runtime Kernels for the Delay Calculations
+ * \version 0.1
+ * \date 2022-05-12
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "ASIC.hpp"
+#include "Parameters.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstdint>
+#include <array>
+
+namespace SoundCath {
+
+/// A Point to Focus on in 3-D Space, in Meters
+struct FocalPoint {
+
+    double x;   ///< X in 3-D Space
+    double y;   ///< Y in 3-D Space
+    double z;   ///< Z in 3-D Space
+
+};
+
+/**
+ * \brief Calculates Transmission Delays at Runtime, the Fast Twin of \ref TXController::CalculateDelays
+ *
+ * The Element Coordinates are Worked Out Once per Transducer, After That a Beam is a Square Root per Element, Written
+ * With \ref SIMD. The Distances are Single Precision, Which is a Few Picoseconds at the Depths we Scan, Nothing Next to
+ * the 12.5ns Delay Resolution.
+ */
+class TxDelayKernel {
+
+public:
+
+    /**
+     * \brief Works Out Where Every Element Is
+     *
+     * \param[in] tparams: The Transducer Geometry
+     * \param[in] delay_res_ns: The Tx Delay Resolution in Nanoseconds
+     */
+    TxDelayKernel(const TransducerParams& tparams, const double delay_res_ns);
+
+    /**
+     * \brief Calculates the Delays to Focus on a Point
+     *
+     * \param[in] focus: Where to Focus
+     * \param[out] delays: The Delays in Units of the Delay Resolution, the Earliest Element is at 0
+     */
+    void Calculate(const FocalPoint& focus, Delays& delays) const noexcept;
+
+    /**
+     * \brief Calculates the Delays for Many Focal Points
+     *
+     * \param[in] foci: Where to Focus
+     * \param[out] delays: The Delays for Each Focal Point
+     * \param[in] count: How Many Focal Points There Are
+     */
+    void Calculate(const FocalPoint* foci, Delays* delays, const size_t count) const noexcept;
+
+    /**
+     * \brief Calculates the Delays for Many Focal Points, Spread Over a Thread Pool
+     *
+     * \param[in] foci: Where to Focus
+     * \param[out] delays: The Delays for Each Focal Point
+     * \param[in] count: How Many Focal Points There Are
+     * \param[in] pool: The Threads to Use
+     */
+    void Calculate(const FocalPoint* foci, Delays* delays, const size_t count, ThreadPool& pool) const;
+
+private:
+
+    alignas(64) std::array<float, 16 * 64> xel;    ///< X Coordinate of Every Element in Meters
+    alignas(64) std::array<float, 16 * 64> yel;    ///< Y Coordinate of Every Element in Meters
+    size_t numelements;                             ///< How Many Elements are Used, the Rest of the Delays are 0
+    double scale;                                   ///< Turns Meters Into Delay Resolution Units
+
+};
+
+/**
+ * \brief Decompresses Taylor Coefficients the Way the ASIC Does, the Fast Twin of \ref TXController::UncompressTaylor and \ref RXController::UncompressTaylor
+ *
+ * The ASIC Evaluates the Polynomial per Group in Fixed Point With Lookup Tables, Then Spreads Each Group Over its 16
+ * Elements. Everything is Integer Math With Floors, so this Gives the Exact Delays the Hardware Applies. The Per Element
+ * Step Runs a Whole Group per Instruction With AVX-512, Half a Group With AVX2 and One Element at a Time Otherwise.
+ *
+ * \note The Output is in the ASIC's Own Order, Element (e / 4, e % 4) of Group (x, y) is at (y * 16 + x) * 16 + e, the Same Order it Reads Delays Back in
+ * \note Only One ASIC is Decompressed, That is the Y Group Offset of 3 From the Spec
+ */
+class TaylorKernel {
+
+public:
+
+    /// Linear Tx Lookup Table, 64 Times the Group Coordinate
+    static constexpr std::array<int32_t, 16> TX_LINEAR = { -120, -104, -88, -72, -56, -40, -24, -8, 8, 24, 40, 56, 72, 88, 104, 120 };
+
+    /// Square Tx Lookup Table
+    static constexpr std::array<int32_t, 16> TX_SQUARE = { 56, 42, 30, 20, 12, 6, 2, 0, 0, 2, 6, 12, 20, 30, 42, 56 };
+
+    /// Cube Tx Lookup Table
+    static constexpr std::array<int32_t, 16> TX_CUBE = { -18, -12, -7, -4, -2, -1, 0, 0, 0, 0, 1, 2, 4, 7, 12, 18 };
+
+    /// XY Cross Term Tx Lookup Table
+    static constexpr std::array<int32_t, 16> TX_LINEARXY = { -15, -13, -11, -9, -7, -5, -3, -1, 1, 3, 5, 7, 9, 11, 13, 15 };
+
+    /// Linear Rx Lookup Table
+    static constexpr std::array<int32_t, 16> RX_LINEAR = { -30, -26, -22, -18, -14, -10, -6, -2, 2, 6, 10, 14, 18, 22, 26, 30 };
+
+    /// Square Rx Lookup Table
+    static constexpr std::array<int32_t, 16> RX_SQUARE = { 28, 21, 15, 10, 6, 3, 1, 0, 0, 1, 3, 6, 10, 15, 21, 28 };
+
+    /// Groups in the X Direction on an ASIC
+    static constexpr int32_t GROUPS_X = 16;
+
+    /// Groups in the Y Direction on an ASIC
+    static constexpr int32_t GROUPS_Y = 4;
+
+    /// Where the ASIC's Groups Start in the Lookup Tables, 2 * (4 - nAsics + 2 * iAsic) for the Only ASIC
+    static constexpr int32_t GROUP_OFFSET_Y = 6;
+
+    /// Fraction Bits of the Tx Center and Element Delays
+    static constexpr int32_t TX_FP = 3;
+
+    /// Element Delays at or Past This are Out of Range, the ASIC Marks Them as \ref TX_INVALID
+    static constexpr int32_t TX_ELEMENT_MAX = 30;
+
+    /// What an Out of Range Tx Element Delay Becomes
+    static constexpr int32_t TX_INVALID = 255;
+
+    /// Number of Dynamic Rx Curves, the Phases Go From 0 to One Less
+    static constexpr int32_t RX_CURVES = 8;
+
+    /**
+     * \brief Decompresses Tx Coefficients Into the Delays the ASIC Fires With
+     *
+     * \param[in] coeffs: The Tx Taylor Coefficients
+     * \param[out] delays: Delay of Every Element in Tx Delay Res Units, \ref TX_INVALID is Added Where the Element Delay is Out of Range
+     */
+    static void UncompressTx(const TxCoeffs& coeffs, QuantDelays& delays) noexcept;
+
+    /**
+     * \brief Decompresses Rx Coefficients Into the Delays and Curves the ASIC Receives With
+     *
+     * \param[in] coeffs: The Rx Taylor Coefficients
+     * \param[out] delays: Delay of Every Element in Rx Delay Res Units
+     * \param[out] phases: The Dynamic Curve Every Element Follows
+     */
+    static void UncompressRx(const RxCoeffs& coeffs, QuantDelays& delays, QuantPhases& phases) noexcept;
+
+};
+
+}
@@ -0,0 +1,175 @@
+/**
+ * \file Logging.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Logging Macros Used on the Hot Path and the Asynchronous File Appender Behind Them
+ * \version 0.1
+ * \date 2022-05-15
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <fstream>
+#include <filesystem>
+#include <condition_variable>
+
+#include <fmt/format.h>
+#include <fmt/compile.h>
+
+#ifndef PLOG_OMIT_LOG_DEFINES
+#define PLOG_OMIT_LOG_DEFINES // plog has its own LOGD and the rest, these are the fmt ones below
+#endif
+
+#include <plog/Log.h>
+#include <plog/Appenders/IAppender.h>
+
+/**
+ * \brief The Most Verbose plog Severity That is Compiled In, Anything More Verbose Compiles to Nothing
+ *
+ * Set it With -DSOUNDCATH_LOG_LEVEL=n (the LOG_LEVEL Cache Variable in CMake), n is a plog::Severity: 0 None, 1 Fatal,
+ * 2 Error, 3 Warning, 4 Info, 5 Debug, 6 Verbose. Release Builds Default to Info so Nothing Logged per Beam is Built.
+ */
+#ifndef SOUNDCATH_LOG_LEVEL
+#ifdef NDEBUG
+#define SOUNDCATH_LOG_LEVEL 4
+#else
+#define SOUNDCATH_LOG_LEVEL 6
+#endif
+#endif
+
+/**
+ * \brief Logs a fmt Formatted Message, the Message is Only Formatted if plog Will Write it
+ *
+ * \param severity: The plog::Severity to Log at
+ * \param ...: The Format String and its Arguments, Same as fmt::format
+ */
+#define SOUNDCATH_LOG(severity, ...) do { IF_PLOG(severity) { PLOG(severity) << fmt::format(__VA_ARGS__); } } while(0)
+
+#if SOUNDCATH_LOG_LEVEL >= 6
+#define LOGV(...) SOUNDCATH_LOG(plog::verbose, __VA_ARGS__)
+#else
+#define LOGV(...) do {} while(0)
+#endif
+
+#if SOUNDCATH_LOG_LEVEL >= 5
+#define LOGD(...) SOUNDCATH_LOG(plog::debug, __VA_ARGS__)
+#else
+#define LOGD(...) do {} while(0)
+#endif
+
+#if SOUNDCATH_LOG_LEVEL >= 4
+#define LOGI(...) SOUNDCATH_LOG(plog::info, __VA_ARGS__)
+#else
+#define LOGI(...) do {} while(0)
+#endif
+
+#if SOUNDCATH_LOG_LEVEL >= 3
+#define LOGW(...) SOUNDCATH_LOG(plog::warning, __VA_ARGS__)
+#else
+#define LOGW(...) do {} while(0)
+#endif
+
+#if SOUNDCATH_LOG_LEVEL >= 2
+#define LOGE(...) SOUNDCATH_LOG(plog::error, __VA_ARGS__)
+#else
+#define LOGE(...) do {} while(0)
+#endif
+
+namespace SoundCath {
+
+/**
+ * \brief A plog Appender That Hands Lines to a Background Thread to Write, Logging Never Waits on the Disk
+ *
+ * The Record is Formatted on the Logging Thread, Only the Finished Line is Queued. The Queue is Bounded, if the Disk
+ * Can't Keep Up Lines are Dropped and Counted Instead of Blocking the Caller.
+ */
+class AsyncAppender : public plog::IAppender {
+
+public:
+
+    /**
+     * \brief Construct a new Async Appender object, Opens the File and Starts the Writer
+     *
+     * \param[in] path: The File to Append to
+     * \param[in] capacity: How Many Lines Can be Waiting Before New Ones are Dropped
+     */
+    explicit AsyncAppender(const std::filesystem::path& path, const size_t capacity = 4096);
+
+    /**
+     * \brief Destroy the Async Appender object, Writes Whatever is Queued and Stops the Writer
+     *
+     */
+    ~AsyncAppender() override;
+
+    AsyncAppender(const AsyncAppender&) = delete;
+    AsyncAppender& operator=(const AsyncAppender&) = delete;
+
+    /**
+     * \brief Queues a Record to be Written, Called by plog
+     *
+     * \param[in] record: The Record to Write
+     */
+    void write(const plog::Record& record) override;
+
+    /**
+     * \brief Waits Until Everything Queued so Far is Written
+     *
+     */
+    void Flush();
+
+    /**
+     * \brief Writes Everything Queued so Far to the Current File, Then Appends to Another One
+     *
+     * \param[in] path: The File to Append to From Now On
+     */
+    void Reopen(const std::filesystem::path& path);
+
+    /**
+     * \brief Get How Many Lines Were Dropped Because the Queue Was Full
+     *
+     * \return uint64_t: The Number of Dropped Lines
+     */
+    uint64_t GetDropped() const noexcept { return dropped.load(std::memory_order_relaxed); }
+
+private:
+
+    /**
+     * \brief The Writer Thread, Writes the Queued Lines in Batches
+     *
+     */
+    void Run();
+
+    std::basic_ofstream<plog::util::nchar> file;       ///< The Log File
+    std::deque<plog::util::nstring> lines;              ///< Lines Waiting to be Written
+    const size_t capacity;                              ///< The Most Lines That Can Wait
+
+    std::mutex lock;                                    ///< Guards the Lines and the Flags
+    std::condition_variable queued;                     ///< Signals the Writer There are Lines
+    std::condition_variable written;                    ///< Signals Flush the Queue is Written
+
+    bool writing{false};                                ///< The Writer Has Lines Out of the Queue
+    bool stop{false};                                   ///< Tells the Writer to Finish
+    std::atomic<uint64_t> dropped{0};                   ///< Lines Dropped so Far
+
+    std::thread writer;                                 ///< The Writer Thread
+
+};
+
+/**
+ * \brief Sets Up plog to Log to a File Through an \ref AsyncAppender, the Appender Lives Until the Program Exits
+ *
+ * Calling it Again Moves the Log to the New File and Sets the New Severity, There is Still Only One Appender.
+ *
+ * \param[in] path: The Log File
+ * \param[in] severity: The Most Verbose Severity to Log at Runtime, Anything Past \ref SOUNDCATH_LOG_LEVEL is Already Gone
+ */
+void InitLogging(const std::filesystem::path& path, const plog::Severity severity = plog::info);
+
+}
@@ -0,0 +1,93 @@
+/**
+ * \file MappedFile.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains a Read Only Memory Mapped File, mmap on POSIX and a File Mapping on Windows
+ * \version 0.1
+ * \date 2022-05-13
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+
+namespace SoundCath {
+
+/**
+ * \brief Maps a Whole File Read Only Into Memory, the Pages are Only Read From Disk When They are Touched
+ *
+ * Opening Never Throws, a File That is Missing, Empty or Can't be Mapped Just Leaves the Object Closed, Check \ref IsOpen
+ */
+class MappedFile {
+
+public:
+
+    /**
+     * \brief Construct a Closed Mapped File object
+     *
+     */
+    MappedFile() noexcept = default;
+
+    /**
+     * \brief Construct a new Mapped File object, Maps the File
+     *
+     * \param[in] path: The File to Map
+     */
+    explicit MappedFile(const std::filesystem::path& path) noexcept;
+
+    /**
+     * \brief Destroy the Mapped File object, Unmaps the File
+     *
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * \brief Unmaps the File, Does Nothing if Nothing is Mapped
+     *
+     */
+    void Close() noexcept;
+
+    /**
+     * \brief Checks if a File is Mapped
+     *
+     * \return true: If the File is Mapped
+     * \return false: If it Couldn't be Mapped or Was Closed
+     */
+    bool IsOpen() const noexcept { return data != nullptr; }
+
+    /**
+     * \brief Get the Start of the Mapping
+     *
+     * \return const std::byte*: The First Byte of the File, nullptr if Nothing is Mapped
+     */
+    const std::byte* GetData() const noexcept { return data; }
+
+    /**
+     * \brief Get the Size of the Mapping
+     *
+     * \return size_t: Size of the File in Bytes
+     */
+    size_t GetSize() const noexcept { return size; }
+
+private:
+
+    const std::byte* data{nullptr};     ///< The Mapped Bytes
+    size_t size{0};                     ///< How Many Bytes are Mapped
+
+#ifdef _WIN32
+    void* mapping{nullptr};             ///< The File Mapping Handle, the File Itself is Closed Right After Mapping
+#endif
+
+};
+
+}
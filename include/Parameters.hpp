@@ -21,7 +21,7 @@
 
 namespace SoundCath {
 
-    /// \todo Add a Compile Time JSON Parameter Parser so the Parameters can be worked with much more easily, Jason Turner's JSON Library should do the trick
+    /// The Parameters can be Read From a Config File at Runtime or While Compiling, see Config.hpp and Preset.hpp
 
     /// Parameters for the FPGA, see the Docs for the complete list of params
     struct FPGAParams {
@@ -125,6 +125,8 @@ namespace SoundCath {
         uint8_t elempergroup{16};   ///< The Number of Elements in each Group
         uint16_t numelements{1024}; ///< The Number of Elements on the Transducer
 
+        constexpr bool operator==(const TransducerParams&) const = default;
+
     };
 
     struct ControllerParams {
@@ -144,6 +146,8 @@ namespace SoundCath {
             double stop_depth_m{.0001};     ///< The Depth to End Scanning At
             double delay_res_ns{20.0};      ///< The Resolution of the ASIC in Nano Seconds
 
+            constexpr bool operator==(const RxParams&) const = default;
+
         };
 
         struct TxParams {
@@ -156,6 +160,8 @@ namespace SoundCath {
             uint8_t L4_sq{32};
             double delay_res_ns{12.5};
 
+            constexpr bool operator==(const TxParams&) const = default;
+
         };
 
         TxParams txparams;          ///< The Transmission Parameters
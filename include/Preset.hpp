@@ -0,0 +1,42 @@
+/**
+ * \file Preset.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Parameter Preset Built Into the Program, Parsed While Compiling
+ * \version 0.1
+ * \date 2022-05-24
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Config.hpp"
+
+#include <string_view>
+
+#if __has_include("PresetText.hpp")
+#include "PresetText.hpp" // written by CMake from the PRESET file, see build/PresetText.hpp.in
+#else
+
+namespace SoundCath {
+
+inline constexpr std::string_view PRESET_PATH = "";    ///< Where the Preset Came From, Nowhere Without CMake
+inline constexpr std::string_view PRESET_TEXT = "";    ///< The Contents of the Preset, Empty so Everything is Default
+
+}
+
+#endif
+
+namespace SoundCath {
+
+/**
+ * \brief The Parameters in the Preset the Program Was Built With
+ *
+ * The Same Text and the Same \ref ParseParams as \ref LoadParams Uses at Runtime, so One File Drives Both the Compile
+ * Time Precalculation (UltraSound<PRESET>, Controller<PRESET.conparams, PRESET.trparams>) and the Runtime Setup, and
+ * Loading PRESET_PATH Gives Back Exactly PRESET. A Preset That Doesn't Parse or is Out of Range Fails the Build.
+ */
+inline constexpr USParams PRESET = ParseParams(PRESET_TEXT);
+
+}
@@ -0,0 +1,47 @@
+/**
+ * \file PresetScan.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Scan Data for the Built in Preset, Calculated by ScanGen at Build Time and Linked Into the Program
+ * \version 0.1
+ * \date 2022-05-25
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Preset.hpp"
+#include "ScanCache.hpp"
+
+#include <cstddef>
+
+extern "C" {
+
+extern const unsigned char SOUNDCATH_PRESET_SCAN[];     ///< A Scan Cache File for the Preset, Written as a Source File by ScanGen
+extern const size_t SOUNDCATH_PRESET_SCAN_SIZE;         ///< Size of it in Bytes
+
+}
+
+namespace SoundCath {
+
+/// The Scan Data for the Built in Preset
+using PresetScanData = ScanData<PRESET.conparams, PRESET.trparams>;
+
+/**
+ * \brief Get the Scan Data for the Built in Preset
+ *
+ * The Tables are Calculated on the Host by ScanGen With \ref Controller::CalcScanData, the Same Calculation as
+ * \ref Controller::PreCalcScanData, and Linked in as a Byte Array in the \ref ScanCache Format. The Compiler Only Sees
+ * the Bytes, so the Program Builds in Seconds Instead of Evaluating the Whole Scan as a Constant Expression.
+ * \note The Two are Only Compared Bit for Bit on a Small Grid in test/Controller, Evaluating the Whole Preset is What This Avoids
+ * \note Only Programs With ScanGen's Output in Their Sources can Use it, see build/CMakeLists.txt
+ * \return const PresetScanData*: The Tables, nullptr if the Linked Tables are for Other Parameters, a Stale Build
+ */
+inline const PresetScanData* GetPresetScanData() noexcept {
+
+    return ScanCache<PRESET.conparams, PRESET.trparams>::Check(reinterpret_cast<const std::byte*>(SOUNDCATH_PRESET_SCAN), SOUNDCATH_PRESET_SCAN_SIZE);
+
+}
+
+}
@@ -0,0 +1,191 @@
+/**
+ * \file Recorder.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Recording and Replay Transports, for Capturing a Session With a Box and Playing it Back Without One
+ * \version 0.1
+ * \date 2022-05-17
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Transport.hpp"
+#include "MappedFile.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <filesystem>
+#include <string_view>
+
+namespace SoundCath {
+
+/**
+ * \brief The Layout of a Recording, a \ref Header Then a \ref Record per Call, Each Followed by the Command and the Response
+ *
+ * The Strings Aren't Null Terminated in the File. Everything is Native Endian, Recordings Move Between Machines of the Same Kind.
+ */
+struct Recording {
+
+    /// Marks a File as a Recording, "SCRC" in the File
+    static constexpr uint32_t MAGIC = 0x43524353;
+
+    /// Version of the File Layout
+    static constexpr uint32_t VERSION = 1;
+
+    /// Starts Every Recording
+    struct Header {
+
+        uint32_t magic;         ///< Always \ref MAGIC
+        uint32_t version;       ///< The \ref VERSION it Was Written With
+
+    };
+
+    /// Starts Every Call in a Recording
+    struct Record {
+
+        uint64_t start_ns;      ///< When the Call Started, From the Start of the Recording
+        uint64_t duration_ns;   ///< How Long the Box Took to Answer
+        uint32_t result;        ///< What the Call Returned, \ref DriverError::Code Flags
+        uint32_t commandsize;   ///< Bytes of Command After the Record
+        uint32_t responsesize;  ///< Bytes of Response After the Command
+        uint32_t reserved;      ///< Keeps the Record 8 Byte Sized, Always 0
+
+    };
+
+};
+
+/**
+ * \brief Passes Every Call Through to Another Transport and Writes the Command, the Response and the Timing to a Recording
+ *
+ * The File is Buffered, Only the Flushes Touch the Disk. Use it in Place of the Transport it Wraps.
+ */
+class RecordingTransport: public Transport {
+
+public:
+
+    /**
+     * \brief Construct a new Recording Transport object, Starts the Recording
+     * \throws DriverException: If the Recording Can't be Created
+     * \param[in] transport: What Actually Carries the Commands, Owned From Here On
+     * \param[in] path: The Recording to Write, Replaced if it Exists
+     */
+    RecordingTransport(std::unique_ptr<Transport> transport, const std::filesystem::path& path);
+
+    /**
+     * \brief Destroy the Recording Transport object, Writes Whatever is Buffered
+     *
+     */
+    ~RecordingTransport() override;
+
+    uint32_t Call(const char* command, char* output) override;
+
+    /**
+     * \brief Writes Whatever is Buffered to the Recording
+     *
+     */
+    void Flush() { file.flush(); }
+
+    /**
+     * \brief Get the Number of Calls Recorded
+     *
+     * \return uint64_t: The Number of Calls
+     */
+    uint64_t GetCount() const noexcept { return count; }
+
+private:
+
+    std::unique_ptr<Transport> transport;                   ///< What Actually Carries the Commands
+    std::ofstream file;                                     ///< The Recording
+    std::chrono::steady_clock::time_point start;            ///< When the Recording Started
+    uint64_t count{0};                                      ///< Calls Recorded
+
+};
+
+/**
+ * \brief Answers Calls From a Recording, in Order, So the Host Side Can be Run and Profiled Without a Box
+ *
+ * Each Call is Matched Against the Next Recorded Command. The Recorded Response and Return Code are Given Back,
+ * Either Straight Away or After the Time the Box Took When it was Recorded.
+ */
+class ReplayTransport: public Transport {
+
+public:
+
+    /// How the Replay Behaves
+    struct Config {
+
+        bool paced{false};      ///< Each Call Takes as Long as it Did When Recorded, Otherwise Calls Return Straight Away
+        bool strict{true};      ///< A Command That Doesn't Match the Recording Fails With \ref DriverError::PARAM
+
+    };
+
+    /**
+     * \brief Construct a new Replay Transport object That Plays as Fast as it Can and Fails on a Mismatch
+     * \throws DriverException: If the Recording Can't be Read or is Malformed
+     * \param[in] path: The Recording to Play
+     */
+    explicit ReplayTransport(const std::filesystem::path& path): ReplayTransport(path, Config()) {}
+
+    /**
+     * \brief Construct a new Replay Transport object, Maps the Recording
+     * \throws DriverException: If the Recording Can't be Read or is Malformed
+     * \param[in] path: The Recording to Play
+     * \param[in] config: How to Play it
+     */
+    ReplayTransport(const std::filesystem::path& path, const Config& config);
+
+    uint32_t Call(const char* command, char* output) override;
+
+    /**
+     * \brief Starts the Recording Over From the First Call
+     *
+     */
+    void Rewind() noexcept { next = 0; }
+
+    /**
+     * \brief Get How Many Calls Have Been Played
+     *
+     * \return size_t: Calls Played Since the Last Rewind
+     */
+    size_t GetPosition() const noexcept { return next; }
+
+    /**
+     * \brief Get How Many Calls are in the Recording
+     *
+     * \return size_t: The Number of Calls
+     */
+    size_t GetSize() const noexcept { return entries.size(); }
+
+    /**
+     * \brief Get How Many Calls Didn't Match the Recording
+     *
+     * \return uint64_t: The Number of Mismatches
+     */
+    uint64_t GetMismatches() const noexcept { return mismatches; }
+
+private:
+
+    /// A Recorded Call, the Strings Point Into the Mapped Recording
+    struct Entry {
+
+        std::string_view command;           ///< What Was Sent
+        std::string_view response;          ///< What Came Back
+        std::chrono::nanoseconds duration;  ///< How Long it Took
+        uint32_t result;                    ///< What the Call Returned
+
+    };
+
+    MappedFile file;                        ///< The Mapped Recording
+    std::vector<Entry> entries;             ///< Every Call in the Recording
+    Config config;                          ///< How to Play it
+    size_t next{0};                         ///< The Next Call to Play
+    uint64_t mismatches{0};                 ///< Calls That Didn't Match
+
+};
+
+}
@@ -0,0 +1,104 @@
+/**
+ * \file RegisterShadow.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Register Shadow, a Copy of the Parameters the Box Was Last Set to so Only Changes are Sent
+ * \version 0.1
+ * \date 2022-05-16
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace SoundCath {
+
+/**
+ * \brief Holds SetParam Values by "Group,Param" Key, Both as the Wanted Configuration and as What the Box Has
+ *
+ * Setting the Same Key Twice Keeps the Last Value, so a Configuration Never Sends a Key More Than Once
+ */
+class RegisterShadow {
+
+public:
+
+    /// A Key That Has to be Sent and the Value to Send
+    struct Change {
+
+        std::string key;        ///< "Group,Param", What Goes Before the ':' in the SetParam Command
+        std::string value;      ///< The Value as it is Sent
+
+    };
+
+    /**
+     * \brief Sets a Parameter, Replaces the Value if the Key is Already There
+     *
+     * \param[in] group: The Group the Parameter is In
+     * \param[in] param: The Parameter Name
+     * \param[in] value: The Value, Formatted the Way it is Sent
+     */
+    void Set(const std::string_view group, const std::string_view param, const auto& value) {
+
+        Commit(fmt::format("{},{}", group, param), fmt::format("{}", value));
+
+    }
+
+    /**
+     * \brief Records That the Box Has Taken a Value
+     *
+     * \param[in] key: The "Group,Param" Key
+     * \param[in] value: The Value it Has Now
+     */
+    void Commit(std::string key, std::string value);
+
+    /**
+     * \brief Forgets a Key, it Will be Sent Again Next Time, for When the Box Might Not Have Taken it
+     *
+     * \param[in] key: The "Group,Param" Key
+     */
+    void Invalidate(const std::string_view key);
+
+    /**
+     * \brief Forgets Everything, Every Key is Sent Again Next Time, for After the Box Resets
+     *
+     */
+    void Clear() noexcept { values.clear(); }
+
+    /**
+     * \brief Get What Has to be Sent to Go From This Configuration to Another
+     *
+     * \param[in] target: The Wanted Configuration
+     * \return std::vector<Change>: Every Key in the Target That is Missing Here or Has a Different Value, in Key Order
+     */
+    std::vector<Change> Diff(const RegisterShadow& target) const;
+
+    /**
+     * \brief Get the Value of a Parameter
+     *
+     * \param[in] group: The Group the Parameter is In
+     * \param[in] param: The Parameter Name
+     * \return const std::string*: The Value, nullptr if the Key isn't Set
+     */
+    const std::string* Get(const std::string_view group, const std::string_view param) const;
+
+    /**
+     * \brief Get the Number of Keys Set
+     *
+     * \return size_t: The Number of Keys
+     */
+    size_t Size() const noexcept { return values.size(); }
+
+private:
+
+    std::map<std::string, std::string, std::less<>> values;    ///< The Values by "Group,Param" Key
+
+};
+
+}
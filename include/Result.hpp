@@ -0,0 +1,162 @@
+/**
+ * \file Result.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Result, a Value or an Error Bitmask, for Calls That Report Errors Without Throwing
+ * \version 0.1
+ * \date 2022-05-20
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <utility>
+#include <type_traits>
+
+namespace SoundCath {
+
+/**
+ * \brief Holds Either a Value or the Error Bitmask That Stopped it, Like std::expected for Error Flags
+ *
+ * The Whole Mask is Kept, Every Flag That Was Set Stays Visible. No Bits Set Means Success. \ref Get Turns an Error
+ * Back Into an Exception for Callers That Want One, Through a ThrowError(E) Found Next to the Error Type.
+ *
+ * \tparam T: The Value, Has to be Default Constructible
+ * \tparam E: The Error Bitmask, an Enum or Integer Where 0 is No Error
+ */
+template<typename T, typename E>
+class [[nodiscard]] Result {
+
+public:
+
+    /**
+     * \brief Construct a Successful Result
+     *
+     * \param[in] value: The Value
+     */
+    constexpr Result(T value) noexcept(std::is_nothrow_move_constructible_v<T>): value(std::move(value)) {}
+
+    /**
+     * \brief Makes a Failed Result
+     *
+     * \param[in] error: The Error Flags
+     * \return Result: A Result Holding the Error
+     */
+    static constexpr Result Fail(const E error) noexcept(std::is_nothrow_default_constructible_v<T>) { Result result{T{}}; result.error = error; return result; }
+
+    /**
+     * \brief Checks if There is a Value
+     *
+     * \return true: If it Succeeded
+     * \return false: If There is an Error
+     */
+    constexpr bool HasValue() const noexcept { return error == E{}; }
+
+    /// Same as \ref HasValue
+    constexpr explicit operator bool() const noexcept { return HasValue(); }
+
+    /**
+     * \brief Get the Error Flags
+     *
+     * \return E: Every Flag That Was Set, 0 if it Succeeded
+     */
+    constexpr E GetError() const noexcept { return error; }
+
+    /**
+     * \brief Get the Value Without Checking
+     * \note Only Meaningful if \ref HasValue
+     * \return const T&: The Value
+     */
+    constexpr const T& GetValue() const& noexcept { return value; }
+
+    /**
+     * \brief Get the Value or Another if it Failed
+     *
+     * \param[in] other: What to Give Back on an Error
+     * \return T: The Value or the Other
+     */
+    constexpr T ValueOr(T other) const& { return HasValue() ? value : std::move(other); }
+
+    /**
+     * \brief Get the Value, Throws the Error if There is One
+     * \throws Whatever ThrowError(E) Throws: If There is an Error
+     * \return T: The Value
+     */
+    T Get() && {
+
+        if(!HasValue())
+            ThrowError(error); // found by ADL next to the error type
+
+        return std::move(value);
+
+    }
+
+private:
+
+    T value;        ///< The Value if it Succeeded
+    E error{};      ///< The Error Flags, 0 if it Succeeded
+
+};
+
+/**
+ * \brief A Result for Calls Without a Value, Just the Error Bitmask
+ *
+ * \tparam E: The Error Bitmask, an Enum or Integer Where 0 is No Error
+ */
+template<typename E>
+class [[nodiscard]] Result<void, E> {
+
+public:
+
+    /**
+     * \brief Construct a Result From the Error Flags, Successful if None are Set
+     *
+     * \param[in] error: The Error Flags
+     */
+    constexpr Result(const E error = E{}) noexcept: error(error) {}
+
+    /**
+     * \brief Makes a Failed Result
+     *
+     * \param[in] error: The Error Flags
+     * \return Result: A Result Holding the Error
+     */
+    static constexpr Result Fail(const E error) noexcept { return Result(error); }
+
+    /**
+     * \brief Checks if it Succeeded
+     *
+     * \return true: If it Succeeded
+     * \return false: If There is an Error
+     */
+    constexpr bool HasValue() const noexcept { return error == E{}; }
+
+    /// Same as \ref HasValue
+    constexpr explicit operator bool() const noexcept { return HasValue(); }
+
+    /**
+     * \brief Get the Error Flags
+     *
+     * \return E: Every Flag That Was Set, 0 if it Succeeded
+     */
+    constexpr E GetError() const noexcept { return error; }
+
+    /**
+     * \brief Throws the Error if There is One
+     * \throws Whatever ThrowError(E) Throws: If There is an Error
+     */
+    void Get() const {
+
+        if(!HasValue())
+            ThrowError(error); // found by ADL next to the error type
+
+    }
+
+private:
+
+    E error{};      ///< The Error Flags, 0 if it Succeeded
+
+};
+
+}
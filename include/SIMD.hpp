@@ -0,0 +1,104 @@
+/**
+ * \file SIMD.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Float Vectors the Kernels are Written With, AVX-512, AVX2 or Plain Floats
+ * \version 0.1
+ * \date 2022-05-12
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * \brief The Float Vectors the Kernels are Written With
+ *
+ * A Kernel is One Loop Over Whole Vectors Then a Plain Loop for the Tail. A Vector is 16 Floats With AVX-512, 8 With
+ * AVX2 and a Single Float Otherwise, so Without SIMD the Vector Loop Does Everything and the Tail Never Runs. Every
+ * Operation is One Instruction and Nothing is Fused, so the Vector Loop and the Tail Round the Same Way.
+ *
+ * \note The Instruction Set is Picked at Compile Time, Release Builds use -march=native
+ */
+namespace SoundCath::SIMD {
+
+#if defined(__AVX512F__)
+
+using Floats = __m512;                  ///< A Vector of Floats
+inline constexpr size_t WIDTH = 16;     ///< Floats in a Vector
+
+inline Floats Set(const float value) noexcept { return _mm512_set1_ps(value); }
+inline Floats Load(const float* in) noexcept { return _mm512_loadu_ps(in); }
+inline void Store(float* out, const Floats value) noexcept { _mm512_storeu_ps(out, value); }
+inline Floats Add(const Floats a, const Floats b) noexcept { return _mm512_add_ps(a, b); }
+inline Floats Sub(const Floats a, const Floats b) noexcept { return _mm512_sub_ps(a, b); }
+inline Floats Mul(const Floats a, const Floats b) noexcept { return _mm512_mul_ps(a, b); }
+inline Floats Min(const Floats a, const Floats b) noexcept { return _mm512_min_ps(a, b); }
+inline Floats Sqrt(const Floats value) noexcept { return _mm512_sqrt_ps(value); }
+inline float ReduceMin(const Floats value) noexcept { return _mm512_reduce_min_ps(value); }
+
+#elif defined(__AVX2__)
+
+using Floats = __m256;                  ///< A Vector of Floats
+inline constexpr size_t WIDTH = 8;      ///< Floats in a Vector
+
+inline Floats Set(const float value) noexcept { return _mm256_set1_ps(value); }
+inline Floats Load(const float* in) noexcept { return _mm256_loadu_ps(in); }
+inline void Store(float* out, const Floats value) noexcept { _mm256_storeu_ps(out, value); }
+inline Floats Add(const Floats a, const Floats b) noexcept { return _mm256_add_ps(a, b); }
+inline Floats Sub(const Floats a, const Floats b) noexcept { return _mm256_sub_ps(a, b); }
+inline Floats Mul(const Floats a, const Floats b) noexcept { return _mm256_mul_ps(a, b); }
+inline Floats Min(const Floats a, const Floats b) noexcept { return _mm256_min_ps(a, b); }
+inline Floats Sqrt(const Floats value) noexcept { return _mm256_sqrt_ps(value); }
+
+inline float ReduceMin(const Floats value) noexcept {
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, value);
+    return *std::min_element(lanes, lanes + 8);
+
+}
+
+#else
+
+using Floats = float;                   ///< A Vector of Floats, Just the One
+inline constexpr size_t WIDTH = 1;      ///< Floats in a Vector
+
+inline Floats Set(const float value) noexcept { return value; }
+inline Floats Load(const float* in) noexcept { return *in; }
+inline void Store(float* out, const Floats value) noexcept { *out = value; }
+inline Floats Add(const Floats a, const Floats b) noexcept { return a + b; }
+inline Floats Sub(const Floats a, const Floats b) noexcept { return a - b; }
+inline Floats Mul(const Floats a, const Floats b) noexcept { return a * b; }
+inline Floats Min(const Floats a, const Floats b) noexcept { return std::min(a, b); }
+inline Floats Sqrt(const Floats value) noexcept { return std::sqrt(value); }
+inline float ReduceMin(const Floats value) noexcept { return value; }
+
+#endif
+
+/**
+ * \brief Get the Instruction Set the Kernels Were Built For
+ *
+ * \return const char*: "AVX-512", "AVX2" or "Scalar"
+ */
+constexpr const char* GetISA() noexcept {
+
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#else
+    return "Scalar";
+#endif
+
+}
+
+}
@@ -0,0 +1,321 @@
+/**
+ * \file ScanCache.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Scan Cache, Keeps Calculated \ref ScanData on Disk and Maps it Back In Instead of Recalculating
+ * \version 0.1
+ * \date 2022-05-13
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Controller.hpp"
+#include "Logging.hpp"
+#include "MappedFile.hpp"
+#include "Parameters.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+namespace SoundCath {
+
+/**
+ * \brief Caches the Scan Data for a Set of Parameters in a File, Later Runs Map the File and Use the Tables in Place
+ *
+ * The File is a \ref Header Followed by the Raw Bytes of the \ref ScanData, so Loading is a Mapping and a Header
+ * Check, Nothing is Parsed or Copied. The File Name Has a Hash of Every Parameter the Tables Depend on, so Each Preset
+ * Gets its Own File and Changing a Parameter Can Never Load Stale Tables.
+ *
+ * \note The Files Aren't Portable, They are Raw Structs, Bump \ref VERSION Whenever the Layout of \ref ScanData Changes
+ *
+ * \tparam params: The Controller Params to Calculate the Scan Data With
+ * \tparam usparams: The Transducer to Calculate the Scan Data For
+ */
+template<ControllerParams params, TransducerParams usparams>
+class ScanCache {
+
+public:
+
+    /// Marks a File as a Scan Cache, "SCSD" in the File, Also Catches Files From a Machine With the Other Endianness
+    static constexpr uint32_t MAGIC = 0x44534353;
+
+    /// Version of the File Layout
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * \brief Get the Hash of Every Parameter the Tables Depend on and of the Layout, Names the File
+     *
+     * \return uint64_t: The Key
+     */
+    static constexpr uint64_t GetKey() noexcept {
+
+        uint64_t hash = FNV_OFFSET;
+
+        hash = Hash(hash, params.txparams.xmax, params.txparams.ymax, params.txparams.L1, params.txparams.L2, params.txparams.L3,
+            params.txparams.L4_sq, params.txparams.delay_res_ns);
+        hash = Hash(hash, params.rxparams.L0, params.rxparams.L1, params.rxparams.L2, params.rxparams.L1MAX, params.rxparams.L2MAX,
+            params.rxparams.c78factor, params.rxparams.start_depth_m, params.rxparams.stop_depth_m, params.rxparams.delay_res_ns);
+        hash = Hash(hash, params.x_max_deg, params.x_min_deg, params.x_steps, params.y_max_deg, params.y_min_deg, params.y_steps,
+            params.z_min_mm, params.z_max_mm, params.depth_range, params.z_steps, params.focus_rx, params.focus_tx, params.usedelays);
+        hash = Hash(hash, usparams.pitch_nm, usparams.group_pitch_nm, usparams.soundspeed, usparams.numgroups, usparams.ygroups,
+            usparams.xgroups, usparams.xelems, usparams.yelems, usparams.elempergroup, usparams.numelements);
+
+        return Hash(hash, VERSION, sizeof(ScanData<params, usparams>));
+
+    }
+
+    /// Starts Every Cache File, Padded so the Tables After it Stay Cache Line Aligned
+    struct alignas(64) Header {
+
+        uint32_t magic;     ///< Always \ref MAGIC
+        uint32_t version;   ///< The \ref VERSION it Was Written With
+        uint64_t key;       ///< The \ref GetKey it Was Written With
+        uint64_t size;      ///< Size of the Scan Data After the Header in Bytes
+
+    };
+
+    static_assert(std::is_trivially_copyable_v<ScanData<params, usparams>>, "The Scan Data is Written and Mapped as Raw Bytes");
+    static_assert(alignof(ScanData<params, usparams>) <= alignof(Header), "The Mapped Scan Data Would be Misaligned");
+
+    /**
+     * \brief Construct a new Scan Cache object, Nothing is Loaded Until \ref Get
+     *
+     * \param[in] directory: Where the Cache Files Live, Created if it Doesn't Exist
+     */
+    explicit ScanCache(std::filesystem::path directory): directory(std::move(directory)) {}
+
+    /**
+     * \brief Get the Scan Data, Maps the Cache File if There is a Good One, Otherwise Calculates the Tables and Writes the File
+     * \note A Cache That Can't be Written Isn't an Error, the Calculated Tables are Used From Memory Instead
+     * \param[in] pool: Threads to Calculate the Scan Data on if it isn't Cached
+     * \return const ScanData&: The Tables, Valid as Long as the Cache is
+     */
+    const ScanData<params, usparams>& Get(ThreadPool& pool) {
+
+        if(data)
+            return *data;
+
+        if(Map())
+            return *data;
+
+        LOGD("{} No Usable Cache at {}, Calculating the Scan Data\n", TAG, GetPath().string());
+        calculated = Controller<params, usparams>::CalcScanData(pool);
+
+        if(Store(*calculated) && Map()) {
+
+            calculated.reset(); // the mapping is what the OS can page out, the copy on the heap isn't
+            return *data;
+
+        }
+
+        data = calculated.get();
+        return *data;
+
+    }
+
+    /**
+     * \brief Get the Scan Data, Calculated on a Pool With a Thread per Core if it isn't Cached
+     *
+     * \return const ScanData&: The Tables, Valid as Long as the Cache is
+     */
+    const ScanData<params, usparams>& Get() {
+
+        if(data)
+            return *data;
+
+        ThreadPool pool;
+        return Get(pool);
+
+    }
+
+    /**
+     * \brief Checks if the Scan Data Came From the Cache File
+     *
+     * \return true: If the Scan Data is Mapped From the File
+     * \return false: If it was Calculated and Couldn't be Cached, or Hasn't Been Loaded
+     */
+    bool IsMapped() const noexcept { return data && !calculated; }
+
+    /**
+     * \brief Get the Path to the Cache File for These Parameters
+     *
+     * \return std::filesystem::path: The Cache File
+     */
+    std::filesystem::path GetPath() const { return directory / fmt::format("scan-{:016x}.bin", GetKey()); }
+
+    /**
+     * \brief Get the Header a Cache File for These Parameters Starts With
+     *
+     * \return Header: The Header
+     */
+    static constexpr Header MakeHeader() noexcept {
+
+        Header header{};
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.key = GetKey();
+        header.size = sizeof(ScanData<params, usparams>);
+        return header;
+
+    }
+
+    /**
+     * \brief Checks the Bytes of a Cache File are for These Parameters, Used for Mapped Files and the Tables ScanGen Builds In
+     *
+     * \param[in] bytes: The Whole File, a \ref Header Then the Scan Data, Aligned at Least Like the Header
+     * \param[in] size: Size of the File in Bytes
+     * \return const ScanData*: The Tables in Place, nullptr if the Bytes are for Something Else
+     */
+    static const ScanData<params, usparams>* Check(const std::byte* const bytes, const size_t size) noexcept {
+
+        if(size != sizeof(Header) + sizeof(ScanData<params, usparams>)) {
+
+            LOGE("{} The Cache is {} Bytes, Expected {}\n", TAG, size, sizeof(Header) + sizeof(ScanData<params, usparams>));
+            return nullptr;
+
+        }
+
+        Header header;
+        std::memcpy(&header, bytes, sizeof(header));
+
+        const Header expected = MakeHeader();
+        if(header.magic != expected.magic || header.version != expected.version || header.key != expected.key || header.size != expected.size) {
+
+            LOGE("{} The Cache Has a Bad Header\n", TAG);
+            return nullptr;
+
+        }
+
+        return reinterpret_cast<const ScanData<params, usparams>*>(bytes + sizeof(Header));
+
+    }
+
+private:
+
+    /// FNV-1a Offset Basis
+    static constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325;
+
+    /// FNV-1a Prime
+    static constexpr uint64_t FNV_PRIME = 0x100000001b3;
+
+    /**
+     * \brief FNV-1a Hashes Values Into a Running Hash, Doubles by Their Bits and Everything Else Widened to 64 Bits
+     *
+     * \param[in] hash: The Hash so Far
+     * \param[in] values: What to Hash
+     * \return uint64_t: The New Hash
+     */
+    template<typename... Values>
+    static constexpr uint64_t Hash(uint64_t hash, const Values... values) noexcept {
+
+        const auto mix = [&hash](const auto value) {
+
+            uint64_t bits;
+            if constexpr (std::is_floating_point_v<decltype(value)>)
+                bits = std::bit_cast<uint64_t>(double(value));
+            else
+                bits = uint64_t(value);
+
+            for(int i = 0; i < 8; i++, bits >>= 8)
+                hash = (hash ^ (bits & 0xFF)) * FNV_PRIME;
+
+        };
+
+        (mix(values), ...);
+        return hash;
+
+    }
+
+    /**
+     * \brief Maps the Cache File if it is There and Matches These Parameters
+     *
+     * \return true: If the Scan Data is Mapped
+     * \return false: If There is No File or it is for Something Else
+     */
+    bool Map() {
+
+        MappedFile mapped(GetPath());
+        if(!mapped.IsOpen())
+            return false;
+
+        const ScanData<params, usparams>* const scandata = Check(mapped.GetData(), mapped.GetSize());
+        if(!scandata) {
+
+            LOGE("{} {} is for Other Parameters, Ignoring it\n", TAG, GetPath().string());
+            return false;
+
+        }
+
+        file = std::move(mapped);
+        data = scandata;
+        return true;
+
+    }
+
+    /**
+     * \brief Writes the Cache File, Through a Temporary File so a Crash Never Leaves Half a File Behind
+     *
+     * \param[in] scandata: The Tables to Write
+     * \return true: If the File was Written
+     * \return false: If it Couldn't be
+     */
+    bool Store(const ScanData<params, usparams>& scandata) const noexcept {
+
+        try {
+
+            std::filesystem::create_directories(directory);
+
+            const auto path = GetPath();
+            auto temp = path;
+            temp += ".tmp";
+
+            const Header header = MakeHeader();
+
+            {
+                std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out.write(reinterpret_cast<const char*>(&scandata), sizeof(scandata));
+
+                if(!out.flush()) {
+
+                    LOGE("{} Couldn't Write {}\n", TAG, temp.string());
+                    out.close();
+                    std::filesystem::remove(temp);
+                    return false;
+
+                }
+            }
+
+            std::filesystem::rename(temp, path);
+            LOGD("{} Cached the Scan Data in {}\n", TAG, path.string());
+            return true;
+
+        }
+        catch(const std::exception& e) {
+
+            LOGE("{} Couldn't Cache the Scan Data: {}\n", TAG, e.what());
+            return false;
+
+        }
+    }
+
+    static constexpr const char* TAG = "ScanCache::";   ///< Tag for the Logs
+
+    std::filesystem::path directory;                            ///< Where the Cache Files Live
+    MappedFile file;                                            ///< The Mapped Cache File
+    std::unique_ptr<ScanData<params, usparams>> calculated;     ///< The Calculated Tables if They Couldn't be Mapped
+    const ScanData<params, usparams>* data{nullptr};            ///< The Tables in Use, From the File or Calculated
+
+};
+
+}
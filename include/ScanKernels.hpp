@@ -0,0 +1,76 @@
+/**
+ * \file ScanKernels.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Runtime Scan Calculation, Picks a Kernel Compiled for the Probe Geometry at Runtime
+ * \version 0.1
+ * \date 2022-05-22
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Controller.hpp"
+#include "Parameters.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+
+namespace SoundCath {
+
+/**
+ * \brief The Scan Tables for a Scan Sized at Runtime, Same Layout as \ref ScanData, Only the Tables the Mode Uses are Filled
+ *
+ */
+struct RuntimeScanData {
+
+    bool usedelays{false};                      ///< If the Delay Tables are Filled Instead of the Taylor Ones
+    size_t beams{0};                            ///< Number of Beams, x_steps * y_steps
+
+    std::vector<TxCoeffs> txcoeffs;             ///< Tx Taylor Coefficients Over the Scan Area
+    std::vector<RxCoeffs> rxcoeffs;             ///< Rx Taylor Coefficients Over the Scan Area
+    std::vector<double> txoffsets;              ///< Transmission Offsets Over the Scan Area
+    std::vector<QuantDelays> txdelays;          ///< Tx Delays Over the Scan Area
+    std::vector<QuantRxDelays> rxdelays;        ///< Rx Delays Over the Scan Area
+    std::vector<GroupDelays> rxgroupdelays;     ///< Group Delays Over the Scan Area for Reception
+
+};
+
+/**
+ * \brief Calculates Scan Data for Parameters Only Known at Runtime
+ *
+ * The Scan Area, Steps, Focus and Mode are Runtime Values. The Taylor Compression is Specialized at Compile Time on the
+ * Probe Geometry, the Transducer and the Tx and Rx Lookup Parameters, so Only the Probes in the Build's Table Have a
+ * Kernel. A Parameter Set is Dispatched to the Kernel Whose Geometry Matches it Exactly.
+ */
+class ScanKernels {
+
+public:
+
+    /**
+     * \brief Checks if a Probe Geometry Has a Kernel in This Build
+     *
+     * \param[in] tparams: The Transducer
+     * \param[in] params: The Controller Params, Only the Tx and Rx Params Matter
+     * \return true: If \ref CalcScanData can Handle it
+     */
+    static bool Supports(const TransducerParams& tparams, const ControllerParams& params) noexcept;
+
+    /**
+     * \brief Calculates the Scan Data, the Beams are Spread Over a Thread Pool
+     *
+     * Bit for Bit the Same as \ref Controller::CalcScanData With the Same Params
+     * \throws ConfigException: If the Probe Geometry Has No Kernel in This Build
+     * \param[in] tparams: The Transducer
+     * \param[in] params: What and How to Scan
+     * \param[in] pool: Threads to Calculate the Beams on
+     * \return std::unique_ptr<RuntimeScanData>: Enough Data to go Over the Whole Scan Volume
+     */
+    static std::unique_ptr<RuntimeScanData> CalcScanData(const TransducerParams& tparams, const ControllerParams& params, ThreadPool& pool);
+
+};
+
+}
@@ -0,0 +1,205 @@
+/**
+ * \file Scheduler.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Command Scheduler, Retries Commands That Failed Because the ASIC or FPGA Was Busy
+ * \version 0.1
+ * \date 2022-05-21
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Driver.hpp"
+#include "ASIC.hpp"
+#include "FPGA.hpp"
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+namespace SoundCath {
+
+/**
+ * \brief Sits in Front of the \ref Driver and Retries Commands That Hit a Busy ASIC or FPGA, Backing Off Between Tries
+ *
+ * A Failed Command is Only Retried When the Status Says Nothing But a Transient Condition is Set: The ASIC Being BUSY,
+ * or the FPGA Reporting CLKBUSY or OVERFULL. Anything Else is Handed Back Right Away.
+ *
+ * Each Cause Keeps its Own Backoff, it Doubles on Every Retry and Halves on Every Success, so it Settles Where the Box
+ * Keeps Up. While a Backoff is Running Every Command Through the Scheduler Waits it Out, so Producers Like the Beam
+ * Queue Slow Down Together Instead of Piling More Commands Onto a Busy Box.
+ */
+class Scheduler {
+
+public:
+
+    /// What a Retry Was For
+    enum Cause : uint8_t {
+
+        ASIC_BUSY = 0,      ///< The ASIC Was Busy
+        FPGA_CLKBUSY,       ///< The FPGA Clock Was Busy
+        FPGA_OVERFULL,      ///< The FPGA Memory Was Full
+        CAUSES              ///< The Number of Causes
+
+    };
+
+    /// How Hard to Retry
+    struct Config {
+
+        uint32_t retries{16};                                       ///< Retries Before Giving Up on a Command
+        std::chrono::nanoseconds minbackoff{std::chrono::microseconds(20)};    ///< The First Backoff for a Cause
+        std::chrono::nanoseconds maxbackoff{std::chrono::milliseconds(5)};     ///< The Longest a Backoff Gets
+
+    };
+
+    /**
+     * \brief Construct a new Scheduler object With the Default Config
+     *
+     * \param[in] driver: The Driver to Send Through, Has to Outlive the Scheduler
+     */
+    explicit Scheduler(Driver& driver): Scheduler(driver, Config()) {}
+
+    /**
+     * \brief Construct a new Scheduler object
+     *
+     * \param[in] driver: The Driver to Send Through, Has to Outlive the Scheduler
+     * \param[in] config: How Hard to Retry
+     */
+    Scheduler(Driver& driver, const Config& config);
+
+    /**
+     * \brief Runs a Non-Throwing Call, Like \ref Driver::TrySend or \ref ASIC::TryQueueBeam, Until it Succeeds, Fails
+     * for a Reason That Isn't Transient, or Runs Out of Retries
+     * \note The Call has to be Safe to Repeat, a Busy Box Didn't Act on the First Try
+     * \tparam Call: Callable Returning DriverResult<>
+     * \param[in] call: What to Run
+     * \return DriverResult<>: The Result of the Last Try
+     */
+    template<typename Call>
+    DriverResult<> Run(Call&& call) {
+
+        for(uint32_t attempt = 0; ; attempt++) {
+
+            WaitTurn();
+            const DriverResult<> result = call();
+            if(result) {
+
+                Relax();
+                return result;
+
+            }
+
+            const std::optional<Cause> cause = Classify(result.GetError());
+            if(!cause)
+                return result;
+
+            if(attempt == config.retries) {
+
+                giveups.fetch_add(1, std::memory_order_relaxed);
+                return result;
+
+            }
+
+            Throttle(*cause);
+
+        }
+    }
+
+    /**
+     * \brief Sends a Command, Retrying it While the Box is Busy
+     *
+     * \param[in] command: Null Terminated Command String to Send
+     * \return DriverResult<>: The Result of the Last Try
+     */
+    DriverResult<> TrySend(const char* command) { return Run([this, command] { return driver.TrySend(command); }); }
+
+    /**
+     * \brief Sends a Command, Retrying it While the Box is Busy
+     * \throws DriverException: If it Failed for Another Reason or Ran Out of Retries
+     * \param[in] command: Null Terminated Command String to Send
+     */
+    void Send(const char* command) { TrySend(command).Get(); }
+
+    /**
+     * \brief Checks if a Backoff is Running, Producers can Hold Off Until it is Over
+     *
+     * \return true: If Commands Are Being Held Back
+     */
+    bool IsThrottled() const noexcept;
+
+    /**
+     * \brief Get the Current Backoff for a Cause
+     *
+     * \param[in] cause: The Cause
+     * \return std::chrono::nanoseconds: How Long the Next Retry for it Would Wait, 0 if it Has Settled
+     */
+    std::chrono::nanoseconds GetBackoff(const Cause cause) const noexcept { return std::chrono::nanoseconds(backoff[cause].load(std::memory_order_relaxed)); }
+
+    /**
+     * \brief Get How Many Times Commands Were Retried for a Cause
+     *
+     * \param[in] cause: The Cause
+     * \return uint64_t: Retries
+     */
+    uint64_t GetRetries(const Cause cause) const noexcept { return retries[cause].load(std::memory_order_relaxed); }
+
+    /**
+     * \brief Get How Many Commands Ran Out of Retries
+     *
+     * \return uint64_t: Commands Given Up On
+     */
+    uint64_t GetGiveUps() const noexcept { return giveups.load(std::memory_order_relaxed); }
+
+    /**
+     * \brief Get How Many Times a Command Waited Out a Backoff Before Going Out
+     *
+     * \return uint64_t: Waits
+     */
+    uint64_t GetStalls() const noexcept { return stalls.load(std::memory_order_relaxed); }
+
+private:
+
+    /**
+     * \brief Reads the Status to Find Out if an Error is Worth Retrying, Also Clears the Latched Status
+     *
+     * \param[in] error: What the Driver Returned
+     * \return std::optional<Cause>: What Made it Fail, Empty if it Shouldn't be Retried
+     */
+    std::optional<Cause> Classify(const DriverError::Code error) const;
+
+    /**
+     * \brief Grows the Backoff for a Cause and Holds Back Every Command Until it is Over
+     *
+     * \param[in] cause: What Made the Command Fail
+     */
+    void Throttle(const Cause cause);
+
+    /**
+     * \brief Shrinks Every Backoff After a Command Went Through
+     *
+     */
+    void Relax() noexcept;
+
+    /**
+     * \brief Waits Until Any Running Backoff is Over
+     *
+     */
+    void WaitTurn() noexcept;
+
+    Driver& driver;             ///< What the Commands Go Through
+    const Config config;        ///< How Hard to Retry
+
+    std::array<std::atomic<int64_t>, CAUSES> backoff{};     ///< The Backoff for Each Cause in ns
+    std::atomic<int64_t> resume{0};                         ///< Steady Clock Time in ns Commands are Held Until
+
+    std::array<std::atomic<uint64_t>, CAUSES> retries{};    ///< Retries for Each Cause
+    std::atomic<uint64_t> giveups{0};                       ///< Commands That Ran Out of Retries
+    std::atomic<uint64_t> stalls{0};                        ///< Times a Command Waited Out a Backoff
+
+};
+
+}
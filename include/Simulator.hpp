@@ -0,0 +1,193 @@
+/**
+ * \file Simulator.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the In Process Simulated USX Box, a Transport for Running Without Hardware
+ * \version 0.1
+ * \date 2022-05-04
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Transport.hpp"
+#include "Driver.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <array>
+#include <atomic>
+#include <map>
+#include <vector>
+#include <chrono>
+#include <random>
+
+namespace SoundCath {
+
+/**
+ * \brief A Simulated USX Box, Parses the Same Command Grammar as the Oldelft DLL and Answers With the Documented Responses
+ *
+ * Keeps Just Enough State to be Consistent: The Last Delays Fired, the User Parameters, the B-Mode Queue and the Error Status.
+ * Latency and Errors can be Injected to Exercise the Host Stack the Way a Real Box Would.
+ *
+ * \note See 176A401 Specification USX DLL for the Commands and the Response Formats
+ */
+class Simulator: public Transport {
+
+public:
+
+    /// How the Simulated Box Behaves
+    struct Config {
+
+        std::chrono::nanoseconds latency{0};            ///< Fixed Round Trip Time Added to Every Call
+        double bytespersec{0.0};                        ///< Link Throughput Applied to the Command Length, 0 for Infinite
+        double errorrate{0.0};                          ///< Probability that Any Command Fails
+        std::string errorprefix{};                      ///< Only Commands Starting With This Can Fail, Empty for All
+        uint32_t drivererror{DriverError::ASICERROR};   ///< What a Failed Command Returns to the Driver
+        uint8_t asicerror{1 << 3};                      ///< ASIC Status Bits Latched on a Failure, Default is BUSY
+        uint32_t fpgaerror{0};                          ///< FPGA Status Bits Latched on a Failure
+        uint32_t seed{0};                               ///< Seed for the Error Injection
+        uint16_t queuecapacity{256};                    ///< Entries the Simulated FPGA B-Mode Queue Holds
+        uint8_t numasics{1};                            ///< How Many ASICs the Box Reports
+
+    };
+
+    /**
+     * \brief Construct a new Simulator object that Behaves Like an Ideal Box
+     *
+     */
+    Simulator(): Simulator(Config()) {}
+
+    /**
+     * \brief Construct a new Simulator object
+     *
+     * \param[in] config: How the Box Should Behave
+     */
+    explicit Simulator(const Config& config);
+
+    uint32_t Call(const char* command, char* output) override;
+
+    /**
+     * \brief Makes the Next Commands Fail Regardless of the Error Rate
+     *
+     * \param[in] count: How Many of the Following Commands Fail
+     */
+    void InjectErrors(const uint32_t count) noexcept { forcederrors = count; }
+
+    /**
+     * \brief Get the Config object
+     *
+     * \return Config&: The Behaviour of the Box, Can be Changed Between Calls
+     */
+    Config& GetConfig() noexcept { return config; }
+
+    /**
+     * \brief Get the Number of Commands Handled so Far
+     *
+     * \return uint64_t: Commands Handled
+     */
+    uint64_t GetCommandCount() const noexcept { return commandcount.load(std::memory_order_relaxed); }
+
+    /**
+     * \brief Get the Number of Entries Uploaded to the Simulated FPGA Queue
+     *
+     * \return uint32_t: The Queue Entries
+     */
+    uint32_t GetQueueEntries() const noexcept { return queueentries; }
+
+private:
+
+    /// A Handler Gets the Argument String (Everything Past the First Colon) and the Output Buffer
+    typedef uint32_t (Simulator::*Handler)(std::string_view args, char* output);
+
+    /**
+     * \brief Decides if the Current Command Fails, Latches the Configured Status Bits if it Does
+     *
+     * \param[in] command: The Command Being Handled
+     * \return true: If the Command Should Fail
+     */
+    bool ShouldFail(std::string_view command);
+
+    /**
+     * \brief Writes "<name>:RESULT:<result>" to the Output
+     *
+     * \param[out] output: Output Buffer
+     * \param[in] name: The Command Name
+     * \param[in] result: What Comes After RESULT:
+     * \return uint32_t: Always OK, so Handlers can Return it Directly
+     */
+    static uint32_t Respond(char* output, std::string_view name, std::string_view result);
+
+    /**
+     * \brief Parses a Comma Separated List of Integers
+     *
+     * \param[in] field: The List
+     * \param[out] values: Where to Write the Values
+     * \param[in] max: The Capacity of values
+     * \return size_t: How many were Parsed, SIZE_MAX if the List is Malformed or too Long
+     */
+    static size_t ParseInts(std::string_view field, int32_t* values, const size_t max) noexcept;
+
+    /**
+     * \brief Checks a Group Number Against the ASICs the Box Has
+     *
+     * \param[in] group: The Group
+     * \return true: If One of the ASICs Has it
+     */
+    bool ValidGroup(const int32_t group) const noexcept { return group >= 0 && group < 64 * int32_t(config.numasics); }
+
+    // ----------------------- Command Handlers ----------------------- //
+
+    uint32_t Ok(std::string_view args, char* output);
+    uint32_t InitializeAsic(std::string_view args, char* output);
+    uint32_t FPGAVersion(std::string_view args, char* output);
+    uint32_t FPGADescription(std::string_view args, char* output);
+    uint32_t DriverVersion(std::string_view args, char* output);
+    uint32_t GetAsicError(std::string_view args, char* output);
+    uint32_t GetBandgap(std::string_view args, char* output);
+    uint32_t GetTemperature(std::string_view args, char* output);
+    uint32_t FireGroup(std::string_view args, char* output);
+    uint32_t FireAsic(std::string_view args, char* output);
+    uint32_t FireGroupReceive(std::string_view args, char* output);
+    uint32_t FireAsicReceive(std::string_view args, char* output);
+    uint32_t FireSingle(std::string_view args, char* output);
+    uint32_t ReadTxDelays(std::string_view args, char* output);
+    uint32_t ReadRxDelays(std::string_view args, char* output);
+    uint32_t SetParam(std::string_view args, char* output);
+    uint32_t GetParam(std::string_view args, char* output);
+    uint32_t QueueCoeffs(std::string_view args, char* output);
+    uint32_t QueueDelays(std::string_view args, char* output);
+    uint32_t QueueRepeat(std::string_view args, char* output);
+    uint32_t QueueUpload(std::string_view args, char* output);
+    uint32_t QueueEntries(std::string_view args, char* output);
+    uint32_t QueueClear(std::string_view args, char* output);
+    uint32_t TriggerEntry(std::string_view args, char* output);
+
+    /// Every Command the Box Understands, Matched Without Regard to Case
+    static const std::array<std::pair<std::string_view, Handler>, 33> handlers;
+
+    Config config;                          ///< How the Box Behaves
+    std::mt19937 rng;                       ///< Drives the Error Injection
+    uint32_t forcederrors{0};               ///< Commands Left that are Forced to Fail
+    std::atomic<uint64_t> commandcount{0};  ///< Commands Handled so Far, Read From Other Threads
+    std::string_view current;               ///< The Name of the Command Being Handled
+
+    uint8_t asicstatus{0};                  ///< Latched ASIC Error Bits, Cleared on Read
+    uint32_t fpgastatus{0};                 ///< Latched FPGA Error Bits, Cleared on Read
+
+    std::vector<int32_t> txdelays;          ///< Tx Delays of the Last Beam, 1024 per ASIC
+    std::vector<int32_t> rxdelays;          ///< Rx Delays of the Last Beam, 1024 per ASIC
+    std::vector<int32_t> rxphases;          ///< Rx Clock Phases of the Last Beam, 1024 per ASIC
+    std::array<int32_t, 1024> scratch;      ///< Parse Space so Handlers Don't Allocate, One ASIC's Worth
+
+    uint32_t queuedbeams{0};                ///< Beams Queued on the Host but Not Uploaded
+    uint32_t queueentries{0};               ///< Beams Uploaded to the FPGA
+    bool havebeam{false};                   ///< If a Beam Was Queued that can be Repeated
+
+    std::map<std::string, std::string, std::less<>> userparams;  ///< Everything Set With SetParam
+
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * \file Status.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Combined ASIC and FPGA Status and the Parsers for the Status and Voltage Responses
+ * \version 0.1
+ * \date 2022-05-19
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "ASIC.hpp"
+#include "FPGA.hpp"
+#include "Driver.hpp"
+
+#include <optional>
+#include <string_view>
+
+namespace SoundCath {
+
+/**
+ * \brief The Error Status of the ASIC and the FPGA, the GetAsicError Response Carries Both so One Round Trip Gets Them
+ *
+ */
+struct DeviceStatus {
+
+    ASICError::Code asic{};     ///< The ASIC Error Flags
+    FPGAError::Code fpga{};     ///< The FPGA Error Flags
+
+    /**
+     * \brief Checks if Neither Has an Error
+     *
+     * \return true: If Both Status Codes are Clear
+     * \return false: If Either Has an Error Set
+     */
+    constexpr bool IsOk() const noexcept { return !asic && !fpga; }
+
+    /**
+     * \brief Finds and Decodes the Status in a Response, Nothing is Allocated
+     *
+     * Looks for "ASIC Error Status: hh" and "FPGA Error Status: hhhhhhhh" Anywhere in the Response, so it Also Reads
+     * a Status Piggybacked on the Response to Another Command
+     *
+     * \param[in] response: The Response to Look Through
+     * \return std::optional<DeviceStatus>: The Status, Empty if the Response Doesn't Have One
+     */
+    static std::optional<DeviceStatus> Parse(const std::string_view response) noexcept;
+
+    /**
+     * \brief Fetches the Status From the Box, One GetAsicError Query
+     * \throws DriverException: If the Query Fails or the Response Doesn't Have a Status
+     * \param[in] driver: The Driver to Ask Through
+     * \return DeviceStatus: The Status of Both
+     */
+    static DeviceStatus Query(const Driver& driver);
+
+};
+
+/**
+ * \brief Parses the Voltage at the End of a Response, Like "GetBandgap:RESULT: Bandgap Voltage: 1.12V", Nothing is Allocated
+ *
+ * \param[in] response: The Response
+ * \return std::optional<double>: The Voltage in Volts, Empty if the Response Doesn't End in One
+ */
+std::optional<double> ParseVolts(std::string_view response) noexcept;
+
+}
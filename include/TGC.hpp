@@ -0,0 +1,124 @@
+/**
+ * \file TGC.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Time Gain Compensation Stage, Makes Up for the Attenuation With Depth
+ * \version 0.1
+ * \date 2022-05-28
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Beamformer.hpp"
+#include "Parameters.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+
+namespace SoundCath {
+
+/**
+ * \brief Time Gain Compensation, Multiplies Each Sample of a Line by the Gain That Makes Up for the Attenuation at its Depth
+ *
+ * The Echo From a Depth z has Gone There and Back, so it is 2 * \ref USParams::attenuation * \ref USParams::freq_cent_mhz * z
+ * dB Down, z in cm. The Lines are Sampled Like the RF, From the Firing, so Sample n Came Back From a Depth of
+ * \ref TransducerParams::soundspeed * n / (2 * Sample Rate). The Gain is Capped so the Noise Past the Deepest Echoes
+ * isn't Blown Up Without Bound.
+ *
+ * The Gain of Every Sample is Kept in a Table, Built the First Time a Line is Compensated After the Parameters or the
+ * Line Length Change, so There is no exp per Sample and Applying it is One Multiply per Sample. Goes Before
+ * \ref BMode, on the RF Lines.
+ *
+ * \note The Table is Rebuilt by the Thread Compensating a Line, so Compensating Single Lines From Several Threads Needs
+ * the Table Built Beforehand With \ref GetGains. The Pool Overloads Build it Before the Lines are Spread Out.
+ */
+class TGC {
+
+public:
+
+    /**
+     * \brief Construct a new TGC object, Nothing is Built Until a Line is Compensated
+     *
+     * \param[in] params: The Parameters, the Attenuation, Center Frequency and Speed of Sound are Used
+     * \param[in] samplerate_hz: Sample Rate of the Lines
+     * \param[in] max_db: The Most Gain Applied
+     */
+    TGC(const USParams& params, const double samplerate_hz, const float max_db = 60.0f) noexcept;
+
+    /**
+     * \brief Changes the Parameters, the Table is Only Rebuilt if Something it Uses has Changed
+     *
+     * \param[in] params: The Parameters
+     */
+    void SetParams(const USParams& params) noexcept;
+
+    /**
+     * \brief Get the Gain of Every Sample, Rebuilds the Table if it's Out of Date
+     *
+     * \param[in] samples: Samples per Line
+     * \return const std::vector<float>&: The Gains, One per Sample
+     */
+    const std::vector<float>& GetGains(const size_t samples);
+
+    /**
+     * \brief Get How Many Times the Table has Been Built
+     *
+     * \return size_t: The Number of Builds
+     */
+    size_t GetBuilds() const noexcept { return builds; }
+
+    /**
+     * \brief Compensates a Line in Place
+     *
+     * \param[in,out] line: The Line
+     * \param[in] samples: Samples in the Line
+     */
+    void Apply(float* line, const size_t samples);
+
+    /**
+     * \brief Compensates a Block of Lines in Place, the Lines are Spread Over a Thread Pool
+     *
+     * \param[in,out] lines: The Lines, Back to Back
+     * \param[in] count: Number of Lines
+     * \param[in] samples: Samples per Line
+     * \param[in] pool: Threads to Compensate the Lines on
+     */
+    void Apply(float* lines, const size_t count, const size_t samples, ThreadPool& pool);
+
+    /**
+     * \brief Compensates Beamformed Lines in Place, the Lines are Spread Over a Thread Pool
+     *
+     * \param[in,out] frame: The Lines
+     * \param[in] pool: Threads to Compensate the Lines on
+     */
+    void Apply(BeamformedFrame& frame, ThreadPool& pool);
+
+private:
+
+    /// Everything the Table is Built From
+    struct Inputs {
+
+        float attenuation{0.0f};        ///< dB/MHz*cm
+        double freq_cent_mhz{0.0};      ///< Center Frequency
+        double soundspeed{0.0};         ///< Speed of Sound in m/s
+        double samplerate_hz{0.0};      ///< Sample Rate of the Lines
+        size_t samples{0};              ///< Samples per Line
+
+        constexpr bool operator==(const Inputs&) const = default;
+
+    };
+
+    /// Multiplies a Line by the Gains
+    static void Multiply(float* line, const float* gains, const size_t samples) noexcept;
+
+    Inputs wanted;                  ///< What the Table Should be Built From, Samples is Set When a Line Comes in
+    Inputs built;                   ///< What the Table Was Built From
+    std::vector<float> gains;       ///< Gain of Every Sample
+    size_t builds{0};               ///< Times the Table has Been Built
+    float max_db;                   ///< The Most Gain Applied
+
+};
+
+}
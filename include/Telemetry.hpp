@@ -0,0 +1,155 @@
+/**
+ * \file Telemetry.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Telemetry Poller, Reads the Health of the ASIC and FPGA in the Background so Nobody Waits on it
+ * \version 0.1
+ * \date 2022-05-18
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Driver.hpp"
+#include "ASIC.hpp"
+#include "FPGA.hpp"
+#include "Status.hpp"
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace SoundCath {
+
+/**
+ * \brief Polls the Error Status, Band Gap and Temperature on its Own Thread and Publishes the Latest Values
+ *
+ * Polls Only Go Out When the Driver is Idle, a Poll That Finds it Busy is Put Off, so the Imaging Path Never Queues
+ * Behind Telemetry. The Values are Packed Into Two Words Published Under a Sequence Count, so Reading Them Takes no
+ * Lock and a Reader Never Sees Half of One Poll and Half of the Next.
+ */
+class Telemetry {
+
+public:
+
+    /// The Latest Health Readings
+    struct Health {
+
+        bool valid{false};                          ///< If Anything Has Been Read Yet
+        ASICError::Code asicerror{};                ///< The ASIC Error Status
+        FPGAError::Code fpgaerror{};                ///< The FPGA Error Status
+        double bandgap_v{0.0};                      ///< The Band Gap Voltage in Volts, to the mV
+        double temperature_v{0.0};                  ///< The Temperature Sensor Voltage in Volts, to the mV
+
+    };
+
+    /**
+     * \brief Construct a new Telemetry object, Starts Polling
+     *
+     * \param[in] driver: The Driver to Poll Through, Has to Outlive the Telemetry
+     * \param[in] period: How Often to Poll
+     */
+    explicit Telemetry(Driver& driver, const std::chrono::milliseconds period = std::chrono::milliseconds(500));
+
+    /**
+     * \brief Destroy the Telemetry object, Stops Polling
+     *
+     */
+    ~Telemetry();
+
+    Telemetry(const Telemetry&) = delete;
+    Telemetry& operator=(const Telemetry&) = delete;
+
+    /**
+     * \brief Get the Latest Health Readings, Never Talks to the Box
+     *
+     * \return Health: The Readings From the Last Poll
+     */
+    Health GetHealth() const noexcept;
+
+    /**
+     * \brief Get How Many Polls Have Completed
+     *
+     * \return uint64_t: The Number of Completed Polls
+     */
+    uint64_t GetPolls() const noexcept { return polls.load(std::memory_order_relaxed); }
+
+    /**
+     * \brief Get How Many Times a Poll Found the Driver Busy and Was Put Off
+     *
+     * \return uint64_t: The Number of Put Off Polls
+     */
+    uint64_t GetDeferred() const noexcept { return deferred.load(std::memory_order_relaxed); }
+
+private:
+
+    /**
+     * \brief Polls Every Period Until Stopped, Runs on its Own Thread
+     *
+     */
+    void Run();
+
+    /**
+     * \brief Reads Everything That Hasn't Been Read This Period and Publishes it
+     *
+     * \return true: If Everything Has Been Read
+     * \return false: If the Driver Was Busy for Some of it
+     */
+    bool Poll();
+
+    /// The Readings Packed Into Two Words
+    typedef std::array<uint64_t, 2> Packed;
+
+    /**
+     * \brief Packs Readings Into the Published Words
+     *
+     * \param[in] readings: The Readings to Pack
+     * \return Packed: Word 0 has the FPGA Status in Bits 0-31, the ASIC Status in 32-39 and Valid in 40, Word 1 has the
+     * Band Gap mV in Bits 0-31 and the Temperature mV in 32-63
+     */
+    static Packed Pack(const Health& readings) noexcept;
+
+    /**
+     * \brief Unpacks the Published Words
+     *
+     * \param[in] words: The Packed Readings
+     * \return Health: The Readings
+     */
+    static Health Unpack(const Packed& words) noexcept;
+
+    /**
+     * \brief Publishes Readings, Only the Poll Thread Writes
+     *
+     * \param[in] readings: The Readings to Publish
+     */
+    void Publish(const Health& readings) noexcept;
+
+    static constexpr uint8_t READ_STATUS = 1 << 0;         ///< The Status Has Been Read This Period
+    static constexpr uint8_t READ_BANDGAP = 1 << 1;        ///< The Band Gap Has Been Read This Period
+    static constexpr uint8_t READ_TEMPERATURE = 1 << 2;    ///< The Temperature Has Been Read This Period
+    static constexpr uint8_t READ_ALL = READ_STATUS | READ_BANDGAP | READ_TEMPERATURE;
+
+    Driver& driver;                             ///< What the Polls Go Through
+    const std::chrono::milliseconds period;     ///< How Often to Poll
+
+    std::atomic<uint32_t> sequence{0};          ///< Odd While the Readings are Being Written
+    std::array<std::atomic<uint64_t>, 2> health{};  ///< The Packed Readings, see \ref Pack
+    std::atomic<uint64_t> polls{0};             ///< Polls Completed
+    std::atomic<uint64_t> deferred{0};          ///< Polls Put Off Because the Driver Was Busy
+
+    Health latest;                              ///< The Readings the Poll Thread is Building
+    uint8_t read{0};                            ///< What Has Been Read This Period
+
+    std::mutex lock;                            ///< Guards the Stop Flag
+    std::condition_variable wake;               ///< Wakes the Poll Thread to Stop
+    bool stop{false};                           ///< Tells the Poll Thread to Finish
+    std::thread poller;                         ///< The Poll Thread
+
+};
+
+}
@@ -0,0 +1,98 @@
+/**
+ * \file ThreadPool.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Thread Pool Used to Spread Scan Calculations Over the Cores
+ * \version 0.1
+ * \date 2022-05-10
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+
+namespace SoundCath {
+
+/**
+ * \brief A Fixed Set of Worker Threads that Run Parallel Loops
+ *
+ * Indices are Handed Out One at a Time From a Shared Counter, so Uneven Work Balances Itself.
+ * The Calling Thread Works Too, so a Pool With No Workers Just Runs the Loop Serially.
+ */
+class ThreadPool {
+
+public:
+
+    /**
+     * \brief Construct a new Thread Pool object, Starts the Workers
+     *
+     * \param[in] threads: How Many Threads Run a Loop Including the Caller, 0 for One per Core
+     */
+    explicit ThreadPool(const size_t threads = 0);
+
+    /**
+     * \brief Destroy the Thread Pool object, Stops and Joins the Workers
+     *
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * \brief Runs body(i) for Every i in [0, count), Returns When All of Them are Done
+     * \note Calls From Different Threads are Run One After Another
+     * \throws Whatever body Throws: The First Exception is Rethrown Here, the Remaining Indices are Skipped
+     * \param[in] count: How Many Indices to Run
+     * \param[in] body: What to Run for Each Index, Has to be Safe to Call Concurrently
+     */
+    void ParallelFor(const size_t count, const std::function<void(size_t)>& body);
+
+    /**
+     * \brief Get the Number of Threads a Loop Runs on, Including the Caller
+     *
+     * \return size_t: Threads per Loop
+     */
+    size_t GetThreadCount() const noexcept { return workers.size() + 1; }
+
+private:
+
+    /**
+     * \brief Takes Indices From the Current Loop Until There are None Left
+     *
+     */
+    void Run() noexcept;
+
+    /**
+     * \brief Waits for Loops and Helps Run Them, Runs on Each Worker Thread
+     *
+     */
+    void Worker();
+
+    std::vector<std::thread> workers;               ///< The Worker Threads
+
+    std::mutex calllock;                            ///< Lets Only One Loop Run at a Time
+    std::mutex lock;                                ///< Guards Everything Below
+    std::condition_variable wake;                   ///< Signals the Workers a New Loop Started or the Pool is Stopping
+    std::condition_variable done;                   ///< Signals the Caller the Last Worker Finished
+
+    const std::function<void(size_t)>* job{nullptr};    ///< The Body of the Current Loop
+    size_t total{0};                                    ///< Indices in the Current Loop
+    std::atomic<size_t> next{0};                        ///< The Next Index to Hand Out
+    size_t running{0};                                  ///< Workers Still in the Current Loop
+    uint64_t generation{0};                             ///< Counts Loops so Workers Don't Run One Twice
+    bool stopping{false};                               ///< If the Pool is Shutting Down
+    std::exception_ptr error;                           ///< The First Exception the Loop Threw
+
+};
+
+}
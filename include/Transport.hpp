@@ -0,0 +1,93 @@
+/**
+ * \file Transport.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Transport Interface the Driver Talks Through and the Oldelft DLL Backend
+ * \version 0.1
+ * \date 2022-05-04
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+
+/**
+ * \brief  Type definition for the dll imported function for the asic call wrapper
+ * \note   From Oldelft
+ */
+typedef int (_stdcall *f_dllfunction)(char *inString, char *outString);
+
+#endif
+
+namespace SoundCath {
+
+/**
+ * \brief Moves Command Strings to a USX Box and Responses Back, Mirrors asic_call_parse From the Oldelft DLL
+ *
+ * \note The Driver Serializes all Calls, Implementations Don't Need to be Thread Safe
+ */
+class Transport {
+
+public:
+
+    virtual ~Transport() = default;
+
+    /**
+     * \brief Sends a Command and Writes the Response
+     *
+     * \param[in] command: Null Terminated Command String, see the DLL Spec for the Grammar
+     * \param[out] output: Buffer for the Null Terminated Response, at Least UINT16_MAX Wide
+     * \return uint32_t: The Return Code, a Combination of \ref DriverError::Code Flags
+     */
+    virtual uint32_t Call(const char* command, char* output) = 0;
+
+};
+
+#if defined(_WIN32) || defined(_WIN64)
+
+/**
+ * \brief Talks to the Real Box Through the Oldelft asic_call_wrapper DLL
+ *
+ */
+class DLLTransport: public Transport {
+
+public:
+
+    /**
+     * \brief Loads the DLL and Finds the asic_call_parse Entry Point
+     *
+     * \param[in] path: Where the DLL Lives
+     */
+    DLLTransport(const char* const path = "..\\..\\lib\\asic_call_wrapper_dll64.dll");
+
+    /**
+     * \brief Closes the Driver and Unloads the DLL
+     *
+     */
+    ~DLLTransport() override;
+
+    uint32_t Call(const char* command, char* output) override;
+
+private:
+
+    f_dllfunction asic_call_parse;      ///< Function pointer from the DLL
+    HINSTANCE dll;                      ///< Handle for the DLL
+
+};
+
+#endif
+
+/**
+ * \brief Makes the Transport the Driver Uses When None is Given, the DLL on Windows and the Simulator Everywhere Else
+ *
+ * \return std::unique_ptr<Transport>: The Platform Default Transport
+ */
+std::unique_ptr<Transport> MakeDefaultTransport();
+
+}
\ No newline at end of file
@@ -15,51 +15,159 @@
 #include "ASIC.hpp"
 #include "FPGA.hpp"
 #include "Driver.hpp"
+#include "Transport.hpp"
+#include "RegisterShadow.hpp"
+#include "ScanKernels.hpp"
+#include "ThreadPool.hpp"
+#include "Config.hpp"
+
+#include <memory>
+#include <string>
 
 namespace SoundCath {
-    
+
     /**
-     * \brief Contains all of the functionality for the Ultrasound
-     * 
-     * \todo Implement generic functionality for the Ultrasound to make it suitable for other hardware, a nice 
+     * \brief The Ultrasound With Every Parameter Taken at Runtime, so Presets can be Loaded From a File and Switched Without a Rebuild
      * 
-     * \tparam params: Physical and Other Parameters for the ASIC
+     * Only the Scan Kernels are Still Specialized at Compile Time, They are Picked by the Probe Geometry, see \ref ScanKernels
      */
-    template<USParams params>
-    class UltraSound {
+    class RuntimeUltraSound {
 
     public:
 
         /**
-         * \brief Construct a new Ultra Sound object
+         * \brief Construct a new Runtime Ultra Sound object on the Platform Default Transport, Sets the Params
+         * 
+         * \throws DriverException: If Any of the Parameters is Rejected
+         * \param[in] usparams: The Parameters to Start With
+         */
+        explicit RuntimeUltraSound(const USParams& usparams);
+
+        /**
+         * \brief Construct a new Runtime Ultra Sound object on a Given Transport, Sets the Params
+         * 
+         * \throws DriverException: If Any of the Parameters is Rejected
+         * \param[in] usparams: The Parameters to Start With
+         * \param[in] transport: What Carries the Commands to the Box, Owned by the Driver
+         */
+        RuntimeUltraSound(const USParams& usparams, std::unique_ptr<Transport> transport);
+
+        /**
+         * \brief Construct a new Runtime Ultra Sound object From a Config File on the Platform Default Transport
+         * 
+         * \throws ConfigException: If the File Can't be Read or Parsed, see \ref ParseParams
+         * \throws DriverException: If Any of the Parameters is Rejected
+         * \param[in] path: The Config File
+         */
+        explicit RuntimeUltraSound(const std::string& path);
+
+        /**
+         * \brief Applies a Parameter Set, Only the Parameters That Differ From What the Box Has are Sent
+         * 
+         * \note The Changes are Queued on the Driver Back to Back and Only Waited on at the End, so they Pipeline. 
+         * Switching Between Presets Costs One Round Trip per Changed Parameter Instead of a Full Re-Init
+         * \note The ASIC Clock Speed is Only Set When Constructed
+         * \throws ConfigException: If a Parameter is Outside its Documented Range, Nothing is Applied, see \ref ValidateParams
+         * \throws DriverException: If Any of the Parameters is Rejected, the Rest are Still Set
+         * \param[in] usparams: The Parameters to Apply
+         */
+        void SetParams(const USParams& usparams);
+
+        /**
+         * \brief Loads a Parameter Set From a Config File and Applies it, see \ref SetParams
+         * 
+         * \throws ConfigException: If the File Can't be Read or Parsed, Nothing is Applied
+         * \throws DriverException: If Any of the Parameters is Rejected, the Rest are Still Set
+         * \param[in] path: The Config File
+         */
+        void LoadParams(const std::string& path);
+
+        /**
+         * \brief Sends Every Parameter of the Last Applied Set Again, for After the Box Has Been Reset
+         * 
+         * \throws DriverException: If Any of the Parameters is Rejected
+         */
+        void ResendParams();
+
+        /**
+         * \brief Calculates the Scan Data for the Last Applied Parameters
          * 
+         * \throws ConfigException: If the Probe Geometry Has No Kernel in This Build
+         * \param[in] pool: Threads to Calculate the Beams on
+         * \return std::unique_ptr<RuntimeScanData>: Enough Data to go Over the Whole Scan Volume
          */
-        UltraSound();
+        std::unique_ptr<RuntimeScanData> CalcScanData(ThreadPool& pool) const { return ScanKernels::CalcScanData(trparams, conparams, pool); }
 
+        /**
+         * \brief Get the Copy of the Parameters the Box Has Taken
+         * 
+         * \return const RegisterShadow&: The Parameters by "Group,Param" Key
+         */
+        const RegisterShadow& GetShadow() const noexcept { return shadow; }
 
     private:
 
-        Controller<params.conparams, params.trparams> controller;
-        ASIC<params.asicparams> asic;
-        FPGA<params.fpgaparams> fpga;
-        Driver driver;
+        Driver driver;      ///< Has to be Constructed Before Everything that Talks Through it
+        ASIC<ASICParams{}> asic;    ///< Only Uses the Params for the Clock Speed, Which is Given at Runtime
+        FPGA<FPGAParams{}> fpga;    ///< Doesn't Use its Params
+
+        TransducerParams trparams;      ///< The Transducer of the Last Applied Set
+        ControllerParams conparams;     ///< The Scan of the Last Applied Set
+
+        RegisterShadow shadow;      ///< The Parameters the Box Has Confirmed
+        RegisterShadow wanted;      ///< The Parameters Last Applied
+
+        /**
+         * \brief Sends Every Wanted Parameter the Box Doesn't Have, Queued Back to Back and Waited on at the End
+         * 
+         * \throws DriverException: If Any of the Parameters is Rejected, the Rest are Still Set
+         */
+        void Sync();
 
         /**
-         * \brief Set the Params Given in the Template Params 
+         * \brief Get Every Parameter a Parameter Set Configures, a Key Given More Than Once Keeps its Last Value
          * 
          * \todo Finish for all parameters
+         * \param[in] usparams: The Parameter Set
+         * \return RegisterShadow: The Parameters by "Group,Param" Key
+         */
+        static RegisterShadow GetRegisters(const USParams& usparams);
+
+    };
+
+    /**
+     * \brief Contains all of the functionality for the Ultrasound
+     * 
+     * The Parameters are Fixed at Compile Time so the Whole Scan can be Precalculated, Everything Talking to the Box is 
+     * Shared With \ref RuntimeUltraSound
+     * 
+     * \todo Implement generic functionality for the Ultrasound to make it suitable for other hardware, a nice 
+     * 
+     * \tparam params: Physical and Other Parameters for the ASIC
+     */
+    template<USParams params>
+    class UltraSound: public RuntimeUltraSound {
+
+        static_assert((ValidateParams(params), true), "The Parameters are Outside Their Documented Ranges, see ValidateParams");
+
+    public:
+
+        /**
+         * \brief Construct a new Ultra Sound object on the Platform Default Transport, Sets the Params Given in the Template Params
          * 
          */
-        void SetParams() const;
-        
+        UltraSound(): RuntimeUltraSound(params) {}
+
         /**
-         * \brief Set the Param object
+         * \brief Construct a new Ultra Sound object on a Given Transport, Sets the Params Given in the Template Params
          * 
-         * \param[in] group: The Group the Parameter is In
-         * \param[in] param: The Parameter Name
-         * \param[in] value: The Value To Set it to, will be converted to a String
+         * \param[in] transport: What Carries the Commands to the Box, Owned by the Driver
          */
-        void SetParam(const char* const group, const char* const param, const auto& value) const ;
+        explicit UltraSound(std::unique_ptr<Transport> transport): RuntimeUltraSound(params, std::move(transport)) {}
+
+    private:
+
+        Controller<params.conparams, params.trparams> controller;
 
     };
 
@@ -0,0 +1,110 @@
+/**
+ * \file main.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Scan Table Generator, Calculates the Built in Preset's Scan Data on the Host and Writes it Out as a Source File
+ * \version 0.1
+ * \date 2022-05-25
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <fstream>
+#include <string_view>
+
+#include "Controller.hpp"
+#include "Preset.hpp"
+#include "ScanCache.hpp"
+#include "ThreadPool.hpp"
+
+#include "fmt/format.h"
+#include "fmt/chrono.h"
+
+using SoundCath::Controller;
+using SoundCath::ScanCache;
+using SoundCath::ScanData;
+using SoundCath::ThreadPool;
+using SoundCath::PRESET;
+
+/// Bytes per Line of the Array
+constexpr size_t LINE_BYTES = 32;
+
+/**
+ * \brief Calculates the Preset's Scan Data and Writes it as a Byte Array in the \ref ScanCache Format, see PresetScan.hpp
+ *
+ * \param argc: The Number of Arguments
+ * \param kwargs: The Arguments, the Source File to Write
+ * \return int: The exit status code
+ */
+int main(const int argc, const char* const* const kwargs) {
+
+    if(argc != 2) {
+
+        fmt::print(stderr, "Usage: {} <Source File to Write>\n", argc ? kwargs[0] : "ScanGen");
+        return 1;
+
+    }
+
+    constexpr auto conparams = PRESET.conparams;
+    constexpr auto trparams = PRESET.trparams;
+    using Cache = ScanCache<conparams, trparams>;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    ThreadPool pool;
+    const auto scandata = Controller<conparams, trparams>::CalcScanData(pool);
+    const auto header = Cache::MakeHeader();
+
+    const auto calculated = std::chrono::steady_clock::now();
+
+    fmt::memory_buffer out;
+    fmt::format_to(std::back_inserter(out), "// Generated by ScanGen From {}, Don't Edit\n\n#include <cstddef>\n\n", SoundCath::PRESET_PATH);
+    fmt::format_to(std::back_inserter(out), "extern \"C\" {{\n\nextern const size_t SOUNDCATH_PRESET_SCAN_SIZE = {};\n\n",
+        sizeof(header) + sizeof(*scandata));
+    fmt::format_to(std::back_inserter(out), "alignas({}) extern const unsigned char SOUNDCATH_PRESET_SCAN[] = {{\n", alignof(Cache::Header));
+
+    const auto write = [&out](const std::string_view bytes) {
+
+        for(size_t i = 0; i < bytes.size(); i++) {
+
+            fmt::format_to(std::back_inserter(out), "{},", uint8_t(bytes[i]));
+            if((i + 1) % LINE_BYTES == 0)
+                out.push_back('\n');
+
+        }
+
+    };
+
+    write({ reinterpret_cast<const char*>(&header), sizeof(header) });
+    write({ reinterpret_cast<const char*>(scandata.get()), sizeof(*scandata) });
+    fmt::format_to(std::back_inserter(out), "\n}};\n\n}}\n");
+
+    // through a temporary file so a failed run never leaves half a source file for the build to pick up
+    const std::filesystem::path path = kwargs[1];
+    auto temp = path;
+    temp += ".tmp";
+
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file.write(out.data(), out.size());
+
+        if(!file.flush()) {
+
+            fmt::print(stderr, "Couldn't Write {}\n", temp.string());
+            return 1;
+
+        }
+    }
+
+    std::filesystem::rename(temp, path);
+
+    fmt::print("Calculated {} Beams of Scan Data in {}, Wrote {} Bytes of Tables to {}\n", size_t(conparams.x_steps) * conparams.y_steps,
+        std::chrono::duration_cast<std::chrono::milliseconds>(calculated - start), sizeof(*scandata), path.string());
+
+    return 0;
+
+}
@@ -10,6 +10,9 @@
  */
 #include "ASIC.hpp"
 #include "Exception.hpp"
+#include "Format.hpp"
+#include "Logging.hpp"
+#include "Status.hpp"
 
 #include <string>
 #include <sstream>
@@ -20,11 +23,17 @@
 #include <fmt/ostream.h>
 #include <fmt/compile.h>
 
-#include <plog/Log.h>
-
 using SoundCath::ASIC;
 using SoundCath::ASICError;
 using SoundCath::ASICParams;
+using SoundCath::DriverException;
+using SoundCath::DriverError;
+using SoundCath::DriverResult;
+using SoundCath::DelayString;
+using SoundCath::ParseTxDelays;
+using SoundCath::ParseRxDelays;
+using SoundCath::DeviceStatus;
+using SoundCath::ParseVolts;
 
 static const char* TAG = "ASIC::";
 
@@ -50,19 +59,35 @@ const char* ASICError::GetErrorMessage(const ASICError::Code code) noexcept {
 }
 
 template<ASICParams params>
-ASIC<params>::ASIC(Driver& driver): driver(driver) {
+ASIC<params>::ASIC(Driver& driver, const ASICParams::ClkSpeed speed): driver(driver) {
+
+    LOGD("{} Constructing\n", TAG);
+    InitializeASIC(speed);
+
+}
+
+template<ASICParams params>
+template<typename Format, typename... Args>
+const char* ASIC<params>::Encode(const Format& format, const Args&... args) const {
+
+    const auto result = fmt::format_to_n(command.data(), command.size() - 1, format, args...);
+    if(result.size > command.size() - 1) { // would have sent a truncated command
 
-    PLOGD << TAG << "Constructing\n";
-    InitializeASIC();
+        LOGE(FMT_COMPILE("{} Command of {} Bytes Doesn't Fit in the Buffer\n"), TAG, result.size);
+        throw DriverException(DriverError::PARAM);
+
+    }
+
+    *result.out = '\0';
+    return command.data();
 
 }
 
 template<ASICParams params>
-void ASIC<params>::InitializeASIC() const {
+void ASIC<params>::InitializeASIC(const ASICParams::ClkSpeed speed) const {
 
-    static std::string command = fmt::format(FMT_COMPILE("InitializeASIC:{}"), params.speed);
-    PLOGD << fmt::format(FMT_COMPILE("{} Initializing ASIC"), TAG);
-    driver.Send(command);
+    LOGD(FMT_COMPILE("{} Initializing ASIC"), TAG);
+    driver.Send(Encode(FMT_COMPILE("InitializeAsic:{}"), uint32_t(speed)));
 
 }
 
@@ -70,14 +95,14 @@ void ASIC<params>::InitializeASIC() const {
 template<ASICParams params>
 ASICError::Code ASIC<params>::GetError() const {
 
-    std::string resp = driver.Query("GetAsicError");
-    // Expected: GetASICError:RESULT:ASIC Error Status: 00, FPGA Error Status 00000000
-    const static std::string header("ASIC Error Status: ");
-    std::string digits = resp.substr(resp.find(header) + header.size(), 2);
+    return GetStatus().asic;
+
+}
+
+template<ASICParams params>
+DeviceStatus ASIC<params>::GetStatus() const {
 
-    uint8_t error = std::stoi(digits, 0, 16);
-    PLOGD << fmt::format("{} Getting Error Code: Result: {}\n", TAG, error);
-    return (ASICError::Code)error;
+    return DeviceStatus::Query(driver);
 
 }
 
@@ -92,97 +117,139 @@ void ASICError::ThrowErrors(const ASICError::Code error) const {
 
 }
 
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFire(const Delays& delays) {
+
+    LOGD(FMT_COMPILE("{} Firing With Delays\n"), TAG);
+    return driver.TrySend(Encode(FMT_COMPILE("FireAsic:{}"), DelayString(delays).View()));
+
+}
+
 template<ASICParams params>
 void ASIC<params>::Fire(const Delays& delays) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing With Delays\n"), TAG);
-    static std::string command = fmt::format(FMT_COMPILE("FireASIC:{}"), delays);
-    this->driver.Send(command);
+    TryFire(delays).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFire(const Group group, const Delays& tx, const GroupDelays& rx) {
+
+    LOGD(FMT_COMPILE("{} Firing With TX Delays and RX Group Delays To RX Group {}\n"), TAG, group);
+    return driver.TrySend(Encode(FMT_COMPILE("FireAsicReceive:{0},{0}:{1}:{2}"), group, DelayString(tx).View(), DelayString(rx).View()));
 
 }
 
 template<ASICParams params>
 void ASIC<params>::Fire(const Group group, const Delays& tx, const GroupDelays& rx) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing With TX Delays and RX Group Delays To RX Group {}\n"), TAG, group);
-    static std::string command = fmt::format(FMT_COMPILE("FireASICRecieve:{},{}:{}:{}"), group, group, tx, rx);
-    this->driver.Send(command);
+    TryFire(group, tx, rx).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFire(const Element elem) {
+
+    LOGD(FMT_COMPILE("{} Firing a Single Element: Group {} Location {}\n"), TAG, elem.group, elem.loc);
+    return driver.TrySend(Encode(FMT_COMPILE("FireSingleElement:{},{}"), elem.group, elem.loc));
 
 }
 
 template<ASICParams params>
 void ASIC<params>::Fire(const Element elem) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing a Single Element: Group {} Location {}\n"), TAG, elem.group, elem.loc);
-    static std::string command = fmt::format(FMT_COMPILE("FireSingleElement:{},{}"), elem.group, elem.loc);
-    this->driver.Send(command);
+    TryFire(elem).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFireGroup(const Group group, const GroupDelays& tx) {
+
+    LOGD(FMT_COMPILE("{} Firing A Group With TX Group Delays, Group {}"), TAG, group);
+    return driver.TrySend(Encode(FMT_COMPILE("FireGroup:{}:{}"), group, DelayString(tx).View()));
 
 }
 
 template<ASICParams params>
 void ASIC<params>::FireGroup(const Group group, const GroupDelays& tx) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing A Group With TX Group Delays, Group {}"), TAG, group);
-    static std::string command = fmt::format(FMT_COMPILE("FireGroup:{},{}"), group, tx);
-    driver.Send(command);
+    TryFireGroup(group, tx).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx) {
+
+    LOGD(FMT_COMPILE("{} Firing A Group With RX and TX Group Delays, Sending and Receiving Group {}"), TAG, group);
+    return driver.TrySend(Encode(FMT_COMPILE("FireGroupReceive:{0},{0},{0}:{1}:{2}"), group, DelayString(tx).View(), DelayString(rx).View()));
 
 }
 
 template<ASICParams params>
 void ASIC<params>::FireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing A Group With RX and TX Group Delays, Sending and Receiving Group {}"), TAG, group);
-    static std::string command = fmt::format(FMT_COMPILE("FireGroupReceive:{0},{0},{0}:{}:{}"), group, tx, rx);
-    driver.Send(command);
+    TryFireGroup(group, tx, rx).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx, const Group output) {
+
+    LOGD(FMT_COMPILE("{} Firing A Group with RX and TX Group Delays Recieving to another group, Sending from Group {}, Receiving To Group {}\n"), TAG, group, output);
+    return driver.TrySend(Encode(FMT_COMPILE("FireGroupReceive:{0},{0},{1}:{2}:{3}"), group, output, DelayString(tx).View(), DelayString(rx).View()));
 
 }
 
 template<ASICParams params>
 void ASIC<params>::FireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx, const Group output) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing A Group with RX and TX Group Delays Recieving to another group, Sending from Group {}, Receiving To Group {}\n"), TAG, group, output);
-    static std::string command = fmt::format(FMT_COMPILE("FireGroupRecieve:{0},{0},{}:{}:{}"), group, output, tx, rx);
-    driver.Send(command);
+    TryFireGroup(group, tx, rx, output).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx, const GroupPhases& rxphases) {
+
+    LOGD(FMT_COMPILE("{} Firing a Group with TX Group Delays and Dynamic RX, Group {}\n"), TAG, group);
+    return driver.TrySend(Encode(FMT_COMPILE("FireGroupReceiveDyn:{0},{0},{0}:{1}:{2},{3}"), group, DelayString(tx).View(), DelayString(rx).View(), DelayString(rxphases).View()));
 
 }
 
 template<ASICParams params>
 void ASIC<params>::FireGroup(const Group group, const GroupDelays& tx, const GroupDelays& rx, const GroupPhases& rxphases) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Firing a Group with TX Group Delays and Dynamic RX, Group {}\n"), TAG, group);
-    static std::string command = fmt::format(FMT_COMPILE("FireGroupReceiveDyn:{0},{0},{0}:{}:{},{}"), group, tx, rx, rxphases);
-    driver.Send(command);
+    TryFireGroup(group, tx, rx, rxphases).Get();
 
 }
 
 template<ASICParams params>
 void ASIC<params>::ReadTXDelays(Delays& delays) {
 
-    PLOGD << TAG << "Reading Last TX Delays\n";
-    static std::string resp = driver.Query("ReadTxDelays");   
-    static std::string delaystr = resp.substr(resp.find("[ASIC 0]:") + 1); // the delay string will be after the ASIC number
-    std::istringstream output(driver.Recv()); // convert the output to a stream so that it can be converted to delays
-    //output >> delays; // convert to delays
+    LOGD("{} Reading Last TX Delays\n", TAG);
+    driver.Query("ReadTxDelays", [&](const std::string_view response) { ParseTxDelays(response, delays); }); // parsed under the driver's lock
 
 }
 
 template<ASICParams params>
 void ASIC<params>::ReadRXDelays(Delays& delays) {
 
-    PLOGD << TAG << "Reading Last RX Delays\n";
-    std::string resp{ driver.Query("ReadRxDelays") };   
-    std::string delaystr{ resp.substr(resp.find("[ASIC 0]:") + 1)}; // the delay string will be after the ASIC number
-    std::istringstream output(driver.Recv()); // convert the output to a stream so that it can be converted to delays
-    //output >> delays; // convert to delays and put it into the delay
+    Phases phases;
+    ReadRXDelays(delays, phases);
 
 }
 
 template<ASICParams params>
-void ASIC<params>::RecvElement(const Element elem) {
+void ASIC<params>::ReadRXDelays(Delays& delays, Phases& phases) {
+
+    LOGD("{} Reading Last RX Delays\n", TAG);
+    driver.Query("ReadRxDelays", [&](const std::string_view response) { ParseRxDelays(response, delays, phases); });
+
+}
 
+template<ASICParams params>
+void ASIC<params>::RecvElement(const Element elem) {
 
-    static std::string command = fmt::format(FMT_COMPILE("ReceiveSingleElement:{},{},{}"), elem.group, elem.loc, elem.group);
-    driver.Send(command);
+    driver.Send(Encode(FMT_COMPILE("ReceiveSingleElement:{},{},{}"), elem.group, elem.loc, elem.group));
 
 }
 
@@ -193,73 +260,128 @@ void ASIC<params>::RecvGroup(const Group group, const GroupDelays& rxdelays) {
 
 }
 
-void QueueBeam(const TxCoeffs& tx, const RxCoeffs& rx) {
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryQueueBeam(const TxCoeffs& tx, const RxCoeffs& rx) {
+
+    LOGD(FMT_COMPILE("{} Queueing A Compressed Beam to Fire\n"), TAG);
+    return driver.TrySend(Encode(FMT_COMPILE("BmodeQueueASICCompCoeff:{:+}:{:+}"), fmt::join(tx, ","), fmt::join(rx, ",")));
+
+}
+
+template<ASICParams params>
+void ASIC<params>::QueueBeam(const TxCoeffs& tx, const RxCoeffs& rx) {
+
+    TryQueueBeam(tx, rx).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryQueueBeam(const Delays& tx, const Delays& rx) {
+
+    LOGD(FMT_COMPILE("{} Queueing a Uncompressed Beam To Fire\n"), TAG);
+    return driver.TrySend(Encode(FMT_COMPILE("BmodeQueueASICDelays:{}:{}"), DelayString(tx).View(), DelayString(rx).View()));
+
+}
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Queueing A Compressed Beam to Fire\n"), TAG);
-    static std::string command = fmt::format(FMT_COMPILE("BmodeQueueASICCompCoeff:{:+}:{:+}"), tx, rx);
-    driver.Send(command);
+template<ASICParams params>
+void ASIC<params>::QueueBeam(const Delays& tx, const Delays& rx) {
+
+    TryQueueBeam(tx, rx).Get();
+
+}
+
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryQueueBeam(const QuantDelays& tx, const QuantRxDelays& rx) {
+
+    LOGD(FMT_COMPILE("{} Queueing a Quantized Beam To Fire\n"), TAG);
+    return driver.TrySend(Encode(FMT_COMPILE("BmodeQueueASICDelays:{}:{}"), DelayString(tx).View(), DelayString(rx).View()));
 
 }
 
-void QueueBeam(const Delays& tx, const Delays& rx) {
+template<ASICParams params>
+void ASIC<params>::QueueBeam(const QuantDelays& tx, const QuantRxDelays& rx) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Queueing a Uncompressed Beam To Fire\n"), TAG);
-    static std::string command = fmt::format(FMT_COMPILE("BmodeQueueASICDelays:{}:{}"), tx, rx);
-    driver.Send(command);
+    TryQueueBeam(tx, rx).Get();
 
 }
 
-void QueueRepeatBeam() {
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryQueueRepeatBeam() {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Queueing A Repeat Beam\n"), TAG);
-    static const std::string command = "BmodeQueueRepeat";
-    driver.Send(command);
+    LOGD(FMT_COMPILE("{} Queueing A Repeat Beam\n"), TAG);
+    return driver.TrySend("BmodeQueueRepeat");
 
 }
 
-void FlushBeamQueue() {
+template<ASICParams params>
+void ASIC<params>::QueueRepeatBeam() {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Flushing/Uploading the Beam Queue\n"), TAG);
-    static const std::string command = "BmodeQueueUpload";
-    driver.Send(command);
+    TryQueueRepeatBeam().Get();
 
 }
 
-uint32_t GetBeamQueueSize() {
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryFlushBeamQueue() {
+
+    LOGD(FMT_COMPILE("{} Flushing/Uploading the Beam Queue\n"), TAG);
+    return driver.TrySend("BmodeQueueUpload");
+
+}
 
-    static const std::string command = "BmodeGetQueueEntries";
-    static uint32_t result = 0;
-    driver.Send(command);
-    std::string result = driver.GetResult()
-    auto endofnum = result.find(' ');
-    std::string number = result.substr(0, endofnum);
-    result = std::stoul(number);
-    PLOGD << fmt::format(FMT_COMPILE("{} Getting the Beam Queue Size: Size {}"), TAG, result);
+template<ASICParams params>
+void ASIC<params>::FlushBeamQueue() {
+
+    TryFlushBeamQueue().Get();
+
+}
+
+template<ASICParams params>
+uint32_t ASIC<params>::GetBeamQueueSize() {
+
+    std::string response = driver.Query("BmodeGetQueueEntries");
+    // Expected: BmodeGetQueueEntries:RESULT:34 Entries
+    std::string number = response.substr(response.find("RESULT:") + 7);
+    uint32_t result = std::stoul(number);
+    LOGD(FMT_COMPILE("{} Getting the Beam Queue Size: Size {}"), TAG, result);
     return result;
 
 }
 
-void ClearBeamQueue() {
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryClearBeamQueue() {
 
-    PLOGD << TAG << "Clearing the Beam Queue\n";
-    static const std::string command = "BmodeClearEntries";
-    driver.Send(command);
+    LOGD("{} Clearing the Beam Queue\n", TAG);
+    return driver.TrySend("BmodeClearEntries");
 
 }
 
-void TriggerBeam(const uint8_t beaminqueue) {
+template<ASICParams params>
+void ASIC<params>::ClearBeamQueue() {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Triggering Beam Number {} to Send"), TAG, beaminqueue);
-    static std::string command = fmt::format(FMT_COMPILE("BmodeTriggerEntry:{}"), beaminqueue);
-    driver.Send(command); 
+    TryClearBeamQueue().Get();
 
 }
 
-void Freeze() {
+template<ASICParams params>
+DriverResult<> ASIC<params>::TryTriggerBeam(const uint8_t beaminqueue) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Freezing the B Mode and Putting the ASIC into Low Power Mode"), TAG);
-    static const std::string command = "BmodeFreeze";
-    driver.Send(command);
+    LOGD(FMT_COMPILE("{} Triggering Beam Number {} to Send"), TAG, beaminqueue);
+    return driver.TrySend(Encode(FMT_COMPILE("BmodeTriggerEntry:{}"), beaminqueue));
+
+}
+
+template<ASICParams params>
+void ASIC<params>::TriggerBeam(const uint8_t beaminqueue) {
+
+    TryTriggerBeam(beaminqueue).Get();
+
+}
+
+template<ASICParams params>
+void ASIC<params>::Freeze() {
+
+    LOGD(FMT_COMPILE("{} Freezing the B Mode and Putting the ASIC into Low Power Mode"), TAG);
+    driver.Send("BmodeFreeze");
 
 }
 
@@ -290,8 +412,8 @@ std::string ASIC<params>::GetSerialNum() {
 template<ASICParams params>
 void ASIC<params>::SetSerialNum(const std::string& serialnum) {
 
-    PLOGD << fmt::format(FMT_COMPILE("{} Setting the Serial Number to: {}"), TAG, serialnum);
-    driver.Send(fmt::format(FMT_COMPILE("SerialNumber:0:{}")), serialnum);
+    LOGD(FMT_COMPILE("{} Setting the Serial Number to: {}"), TAG, serialnum);
+    driver.Send(Encode(FMT_COMPILE("SerialNumber:0:{}"), serialnum));
     this->serialnum = serialnum;
 
 }
@@ -299,13 +421,13 @@ void ASIC<params>::SetSerialNum(const std::string& serialnum) {
 template<ASICParams params>
 double ASIC<params>::GetBandGapV() const {
 
-    driver.Send("GetBandgap");
-    std::string resp = driver.GetResult();
-    auto end = resp.find('V');
-    std::string num = resp.substr(0, end - 1);
-    double result = std::stod(num);
-    PLOGD << fmt::format(FMT_COMPILE("{} Getting Bandgap, Bandgap: {}"), TAG, result);
-    return result;
+    // "GetBandgap:RESULT: Bandgap Voltage: 1.12V", the first 'V' is in "Voltage" so parse from the last field
+    const auto result = ParseVolts(driver.Query("GetBandgap"));
+    if(!result)
+        throw DriverException(DriverError::USB_RECEIVE);
+
+    LOGD(FMT_COMPILE("{} Getting Bandgap, Bandgap: {}"), TAG, *result);
+    return *result;
 
 }
 
@@ -320,17 +442,28 @@ bool ASIC<params>::RunTests() const {
 
 // --------------------------- Utility Functions ------------------------- //
 
+std::ostream& SoundCath::operator<<(std::ostream& os, const SoundCath::GroupDelays& delays) {
+
+    const DelayString text(delays);
+    return os.write(text.View().data(), text.View().size());
+
+}
+
 std::ostream& SoundCath::operator<<(std::ostream& os, const SoundCath::Delays& delays) {
 
-    (void)delays;
-    return os;
+    const DelayString text(delays);
+    return os.write(text.View().data(), text.View().size());
 
 }
 
 std::istream& SoundCath::operator>>(std::istream& is, SoundCath::Delays& delays) {
 
-    (void)delays;
+    std::string list;
+    if(is >> list && !ParseDelays(list, delays))
+        is.setstate(std::ios_base::failbit);
+
     return is;
 
 }
 
+template class SoundCath::ASIC<SoundCath::ASICParams{}>;
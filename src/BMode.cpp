@@ -0,0 +1,165 @@
+/**
+ * \file BMode.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the B-Mode Stage
+ * \version 0.1
+ * \date 2022-05-27
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "BMode.hpp"
+#include "SIMD.hpp"
+
+#include <bit>
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+
+using SoundCath::BMode;
+using SoundCath::BeamformedFrame;
+
+/**
+ * \brief log2 From the Exponent Bits and a Quadratic on the Mantissa, Within .008 so About .02 dB
+ *
+ * The Quadratic is Exact at Both Ends of the Mantissa so There is no Step Between Powers of Two
+ * \param[in] x: A Positive Number, 0 Comes Out at -127
+ * \return float: log2(x)
+ */
+static inline float FastLog2(const float x) noexcept {
+
+    const uint32_t bits = std::bit_cast<uint32_t>(x);
+    const float exponent = float(int32_t(bits >> 23) - 127);
+    const float fraction = std::bit_cast<float>((bits & 0x007FFFFF) | 0x3F800000) - 1.0f; // 0 to 1
+
+    return exponent + fraction * (1.3466f - 0.3466f * fraction);
+
+}
+
+BMode::BMode(const Config& config) {
+
+    const size_t taps = config.taps | 1;
+    const double half = double(taps / 2);
+    const double center = config.freq_cent_mhz * 1e6 / config.samplerate_hz;    // cycles per sample
+    const double cutoff = config.bandwidth * center / 2.0;                      // of the lowpass, half the passband
+
+    std::vector<double> lowpass(taps);
+    double sum = 0.0;
+    for(size_t k = 0; k < taps; k++) {
+
+        const double t = double(k) - half;
+        const double sinc = t == 0.0 ? 2.0 * cutoff : std::sin(2.0 * std::numbers::pi * cutoff * t) / (std::numbers::pi * t);
+        const double window = .5 - .5 * std::cos(2.0 * std::numbers::pi * double(k + 1) / double(taps + 1));
+
+        lowpass[k] = sinc * window;
+        sum += lowpass[k];
+
+    }
+
+    // unity gain at the center once shifted, and doubled since a real tone only has half its power on the positive side
+    inphase.resize(taps);
+    quadrature.resize(taps);
+    for(size_t k = 0; k < taps; k++) {
+
+        const double t = double(k) - half;
+        inphase[k] = float(2.0 * lowpass[k] / sum * std::cos(2.0 * std::numbers::pi * center * t));
+        quadrature[k] = float(2.0 * lowpass[k] / sum * std::sin(2.0 * std::numbers::pi * center * t));
+
+    }
+
+    // pixel = 255 * (dB + dbrange) / dbrange, dB = 10 log10(power) - 20 log10(reference)
+    gain = float(255.0 / config.dbrange * 10.0 * std::log10(2.0));
+    offset = float(255.0 - 255.0 / config.dbrange * 20.0 * std::log10(double(config.reference)));
+
+}
+
+BMode::BMode(const USParams& params, const double samplerate_hz): BMode([&] {
+
+    Config config;
+    config.samplerate_hz = samplerate_hz;
+    config.freq_cent_mhz = params.freq_cent_mhz;
+    config.dbrange = params.asicparams.bmodesettings.dbrange;
+    return config;
+
+}()) {}
+
+void BMode::Filter(const float* rf, const size_t samples, float* i, float* q) const {
+
+    const size_t taps = inphase.size();
+    const size_t half = taps / 2;
+
+    // zeros past both ends so every sample sees the whole filter, kept per thread so a line doesn't allocate
+    thread_local std::vector<float> padded;
+    padded.assign(samples + taps - 1, 0.0f);
+    std::copy(rf, rf + samples, padded.begin() + half);
+
+    std::fill(i, i + samples, 0.0f);
+    std::fill(q, q + samples, 0.0f);
+
+    // i[n] = sum over k of inphase[k] * rf[n + half - k], one tap at a time over every sample
+    for(size_t k = 0; k < taps; k++) {
+
+        const float* const in = padded.data() + (taps - 1 - k);
+        const float ti = inphase[k];
+        const float tq = quadrature[k];
+        size_t n = 0;
+
+        const SIMD::Floats vi = SIMD::Set(ti), vq = SIMD::Set(tq);
+        for(; n + SIMD::WIDTH <= samples; n += SIMD::WIDTH) {
+
+            const SIMD::Floats x = SIMD::Load(in + n);
+            SIMD::Store(i + n, SIMD::Add(SIMD::Load(i + n), SIMD::Mul(vi, x)));
+            SIMD::Store(q + n, SIMD::Add(SIMD::Load(q + n), SIMD::Mul(vq, x)));
+
+        }
+
+        for(; n < samples; n++) { // the tail, past the last whole vector
+            i[n] += ti * in[n];
+            q[n] += tq * in[n];
+        }
+    }
+}
+
+void BMode::Envelope(const float* rf, const size_t samples, float* envelope) const {
+
+    thread_local std::vector<float> q;
+    q.resize(samples);
+
+    Filter(rf, samples, envelope, q.data());
+    for(size_t n = 0; n < samples; n++)
+        envelope[n] = std::sqrt(envelope[n] * envelope[n] + q[n] * q[n]);
+
+}
+
+void BMode::ProcessLine(const float* rf, const size_t samples, uint8_t* pixels) const {
+
+    thread_local std::vector<float> i, q;
+    i.resize(samples);
+    q.resize(samples);
+
+    Filter(rf, samples, i.data(), q.data());
+
+    // the compiler vectorizes this one on its own
+    for(size_t n = 0; n < samples; n++) {
+
+        const float pixel = gain * FastLog2(i[n] * i[n] + q[n] * q[n]) + offset;
+        pixels[n] = uint8_t(std::clamp(pixel, 0.0f, 255.0f) + .5f);
+
+    }
+}
+
+void BMode::Process(const float* lines, const size_t count, const size_t samples, uint8_t* pixels, ThreadPool& pool) const {
+
+    pool.ParallelFor(count, [&](const size_t line) {
+        ProcessLine(lines + line * samples, samples, pixels + line * samples);
+    });
+
+}
+
+void BMode::Process(const BeamformedFrame& frame, std::vector<uint8_t>& pixels, ThreadPool& pool) const {
+
+    pixels.resize(frame.lines * frame.samples);
+    Process(frame.data.data(), frame.lines, frame.samples, pixels.data(), pool);
+
+}
@@ -0,0 +1,209 @@
+/**
+ * \file Beamformer.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Delay and Sum Beamformer
+ * \version 0.1
+ * \date 2022-05-26
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Beamformer.hpp"
+#include "Exception.hpp"
+#include "SIMD.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <numbers>
+
+#include <fmt/format.h>
+
+using SoundCath::Beamformer;
+using SoundCath::RFFrame;
+using SoundCath::BeamformedFrame;
+using SoundCath::DelayTable;
+using SoundCath::Delays;
+using SoundCath::QuantDelays;
+using SoundCath::QuantRxDelays;
+using SoundCath::TaylorKernel;
+using SoundCath::ConfigException;
+
+/// A Hann Window Sampled in the Middle of Each of the Channels, so the Edges Aren't Weighted 0
+static float Hann(const int index, const int count) noexcept {
+
+    return float(.5 - .5 * std::cos(2.0 * std::numbers::pi * (index + .5) / count));
+
+}
+
+Beamformer::Beamformer(const TransducerParams& tparams, const double samplerate_hz, const double delay_res_ns, const Channels channels, const Window window):
+    mode(channels),
+    elements(std::min<size_t>(size_t(tparams.ygroups) * tparams.xgroups * tparams.elempergroup, 16 * 64)),
+    pergroup(channels == GROUPS ? 1 : tparams.elempergroup),
+    scale(delay_res_ns * 1e-9 * samplerate_hz) {
+
+    apodization.resize(elements / tparams.elempergroup * pergroup);
+    groupx.resize(elements / tparams.elempergroup);
+    groupy.resize(groupx.size());
+
+    // same element layout as TXController::CalculateDelays, group (xg, yg) is yg * xgroups + xg
+    const int xcount = channels == GROUPS ? tparams.xgroups : tparams.xgroups * tparams.xelems;
+    const int ycount = channels == GROUPS ? tparams.ygroups : tparams.ygroups * tparams.yelems;
+    for(size_t channel = 0; channel < apodization.size(); channel++) {
+
+        const int group = int(channel / pergroup);
+        const int element = int(channel % pergroup);
+
+        int x = group % tparams.xgroups;
+        int y = group / tparams.xgroups;
+        if(channels == ELEMENTS) {
+            x = x * tparams.xelems + element / tparams.yelems;
+            y = y * tparams.yelems + element % tparams.yelems;
+        }
+
+        apodization[channel] = window == HANN ? Hann(x, xcount) * Hann(y, ycount) : 1.0f;
+
+    }
+
+    const double travel = tparams.group_pitch_nm * 1e-9 / tparams.soundspeed * samplerate_hz; // samples from one group to the next
+    for(size_t group = 0; group < groupx.size(); group++) {
+
+        groupx[group] = (double(group % tparams.xgroups) - (tparams.xgroups - 1) / 2.0) * travel;
+        groupy[group] = (double(group / tparams.xgroups) - (tparams.ygroups - 1) / 2.0) * travel;
+
+    }
+}
+
+void Beamformer::SetApodization(std::vector<float> weights) {
+
+    if(weights.size() != apodization.size())
+        throw ConfigException(fmt::format("The Apodization Needs {} Weights, Got {}", apodization.size(), weights.size()));
+
+    apodization = std::move(weights);
+
+}
+
+template<typename T, size_t N>
+void Beamformer::ToChannels(const std::array<T, N>& delays, float* samples) const noexcept {
+
+    // the ASIC has already delayed the elements summed into a group output
+    for(size_t channel = 0; channel < apodization.size(); channel++)
+        samples[channel] = mode == ELEMENTS && channel < N ? float(double(delays[channel]) * scale) : 0.0f;
+
+}
+
+void Beamformer::GetChannelDelays(const Delays& delays, float* samples) const noexcept { ToChannels(delays, samples); }
+
+void Beamformer::GetChannelDelays(const QuantDelays& delays, float* samples) const noexcept { ToChannels(delays, samples); }
+
+void Beamformer::GetChannelDelays(const QuantRxDelays& delays, float* samples) const noexcept { ToChannels(delays, samples); }
+
+void Beamformer::AddGroupDelays(const double x_deg, const double y_deg, float* samples) const noexcept {
+
+    const double sx = std::sin(x_deg * std::numbers::pi / 180.0);
+    const double sy = std::sin(y_deg * std::numbers::pi / 180.0);
+
+    for(size_t channel = 0; channel < apodization.size(); channel++) {
+
+        const size_t group = channel / pergroup;
+        samples[channel] = float(double(samples[channel]) + groupx[group] * sx + groupy[group] * sy);
+
+    }
+}
+
+QuantDelays Beamformer::ToTransducerOrder(const QuantDelays& delays) noexcept {
+
+    QuantDelays out{};
+    for(int32_t y = 0; y < TaylorKernel::GROUPS_Y; y++)
+        for(int32_t x = 0; x < TaylorKernel::GROUPS_X; x++)
+            for(int32_t e = 0; e < 16; e++) // element (e / 4, e % 4) of group (x, y) is element (e % 4, e / 4) of group (y, x)
+                out[(x * TaylorKernel::GROUPS_Y + y) * 16 + (e % 4) * 4 + e / 4] = delays[(y * TaylorKernel::GROUPS_X + x) * 16 + e];
+
+    return out;
+
+}
+
+void Beamformer::Accumulate(const float* rf, float* line, const size_t samples, const float weight, const float delay) noexcept {
+
+    // line[n] += weight * rf(n - delay), between rf[n - whole - 1] and rf[n - whole]
+    const float floor = std::floor(delay);
+    const float frac = delay - floor;
+    const float a = weight * (1.0f - frac);
+    const float b = weight * frac;
+
+    const ptrdiff_t whole = ptrdiff_t(floor);
+    const ptrdiff_t count = ptrdiff_t(samples);
+    const ptrdiff_t start = std::clamp<ptrdiff_t>(whole + 1, 0, count);
+    const ptrdiff_t stop = std::clamp<ptrdiff_t>(count + whole, start, count);
+
+    // the first and last samples only have a zero past the end of the rf to interpolate against
+    if(whole >= 0 && whole < count)
+        line[whole] += a * rf[0];
+    if(whole < 0 && whole + count >= 0)
+        line[whole + count] += b * rf[count - 1];
+
+    const float* const now = rf - whole;
+    const float* const before = now - 1;
+    ptrdiff_t n = start;
+
+    const SIMD::Floats va = SIMD::Set(a), vb = SIMD::Set(b);
+    for(; n + ptrdiff_t(SIMD::WIDTH) <= stop; n += SIMD::WIDTH) {
+
+        const SIMD::Floats sum = SIMD::Add(SIMD::Mul(va, SIMD::Load(now + n)), SIMD::Mul(vb, SIMD::Load(before + n)));
+        SIMD::Store(line + n, SIMD::Add(SIMD::Load(line + n), sum));
+
+    }
+
+    for(; n < stop; n++) // the tail, past the last whole vector
+        line[n] += a * now[n] + b * before[n];
+
+}
+
+void Beamformer::FormLine(const RFFrame& frame, const float* delays, float* line) const {
+
+    if(frame.channels != apodization.size())
+        throw ConfigException(fmt::format("The RF Has {} Channels, the Beamformer is Set Up for {}", frame.channels, apodization.size()));
+
+    std::fill(line, line + frame.samples, 0.0f);
+    for(size_t channel = 0; channel < frame.channels; channel++)
+        if(apodization[channel] != 0.0f)
+            Accumulate(frame.GetChannel(channel), line, frame.samples, apodization[channel], delays[channel]);
+
+}
+
+void Beamformer::Form(const RFFrame& frame, const DelayTable& delays, BeamformedFrame& image, ThreadPool& pool) const {
+
+    if(frame.channels != apodization.size() || delays.channels != apodization.size())
+        throw ConfigException(fmt::format("The RF Has {} Channels and the Delays {}, the Beamformer is Set Up for {}", frame.channels,
+            delays.channels, apodization.size()));
+
+    image.lines = delays.lines;
+    image.samples = frame.samples;
+    image.data.resize(image.lines * image.samples);
+
+    pool.ParallelFor(delays.lines, [&](const size_t line) {
+        FormLine(frame, delays.samples.data() + line * delays.channels, image.data.data() + line * image.samples);
+    });
+
+}
+
+void Beamformer::Form(const std::vector<RFFrame>& frames, const DelayTable& delays, BeamformedFrame& image, ThreadPool& pool) const {
+
+    if(frames.size() != delays.lines || delays.channels != apodization.size())
+        throw ConfigException(fmt::format("Got {} Frames for {} Lines of {} Channels, the Beamformer is Set Up for {}", frames.size(),
+            delays.lines, delays.channels, apodization.size()));
+
+    const size_t samples = frames.empty() ? 0 : frames.front().samples;
+    for(const RFFrame& frame: frames)
+        if(frame.samples != samples || frame.channels != apodization.size())
+            throw ConfigException(fmt::format("Every Frame Needs {} Channels of {} Samples", apodization.size(), samples));
+
+    image.lines = delays.lines;
+    image.samples = samples;
+    image.data.resize(image.lines * image.samples);
+
+    pool.ParallelFor(delays.lines, [&](const size_t line) {
+        FormLine(frames[line], delays.samples.data() + line * delays.channels, image.data.data() + line * image.samples);
+    });
+
+}
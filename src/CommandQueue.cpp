@@ -0,0 +1,93 @@
+/**
+ * \file CommandQueue.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Bounded Command Queue
+ * \version 0.1
+ * \date 2022-05-02
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "CommandQueue.hpp"
+
+#include <cassert>
+
+using SoundCath::CommandQueue;
+using SoundCath::Command;
+
+CommandQueue::CommandQueue(const size_t capacity): capacity(capacity) {
+
+    assert(capacity); // a queue that can't hold anything would deadlock the first push
+
+}
+
+bool CommandQueue::Push(Command&& command) {
+
+    std::unique_lock<std::mutex> guard(lock);
+    notfull.wait(guard, [this] { return closed || commands.size() < capacity; });
+
+    if(closed)
+        return false;
+
+    commands.push_back(std::move(command));
+    guard.unlock();
+    notempty.notify_one();
+    return true;
+
+}
+
+bool CommandQueue::Pop(Command& command) {
+
+    std::unique_lock<std::mutex> guard(lock);
+    notempty.wait(guard, [this] { return closed || !commands.empty(); });
+
+    if(commands.empty()) // only happens once closed
+        return false;
+
+    command = std::move(commands.front());
+    commands.pop_front();
+    inflight++;
+    guard.unlock();
+    notfull.notify_one();
+    return true;
+
+}
+
+void CommandQueue::Done() noexcept {
+
+    std::unique_lock<std::mutex> guard(lock);
+    inflight--;
+    const bool drained = commands.empty() && !inflight;
+    guard.unlock();
+
+    if(drained)
+        idle.notify_all();
+
+}
+
+void CommandQueue::WaitIdle() const {
+
+    std::unique_lock<std::mutex> guard(lock);
+    idle.wait(guard, [this] { return commands.empty() && !inflight; });
+
+}
+
+void CommandQueue::Close() noexcept {
+
+    {
+        std::scoped_lock<std::mutex> guard(lock);
+        closed = true;
+    }
+
+    notempty.notify_all();
+    notfull.notify_all();
+
+}
+
+size_t CommandQueue::Pending() const noexcept {
+
+    std::scoped_lock<std::mutex> guard(lock);
+    return commands.size() + inflight;
+
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/**
+ * \file Config.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Parameter File Loader and the Parse Errors
+ * \version 0.1
+ * \date 2022-05-22
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Config.hpp"
+#include "Exception.hpp"
+#include "Logging.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <fmt/format.h>
+
+using SoundCath::USParams;
+using SoundCath::ConfigException;
+
+static const char* const TAG = "Config::";
+
+void SoundCath::ThrowParseError(const size_t line, const std::string_view what, const std::string_view text) {
+
+    throw ConfigException(fmt::format("Line {}: {} \"{}\"", line, what, text));
+
+}
+
+void SoundCath::ThrowRangeError(const std::string_view key, const int64_t value, const int64_t min, const int64_t max) {
+
+    throw ConfigException(fmt::format("{} is {}, it has to be From {} to {}", key, value, min, max));
+
+}
+
+void SoundCath::ThrowConfigError(const std::string_view message) {
+
+    throw ConfigException(std::string(message));
+
+}
+
+USParams SoundCath::LoadParams(const std::string& path) {
+
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+        throw ConfigException(fmt::format("Couldn't Open {}", path));
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+
+    LOGI("{} Loading Parameters From {}\n", TAG, path);
+
+    try {
+        return ParseParams(contents.str());
+    }
+    catch(const ConfigException& e) { // say which file it was
+        throw ConfigException(fmt::format("{}: {}", path, e.what()));
+    }
+}
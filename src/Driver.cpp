@@ -11,9 +11,9 @@
 
 #include "Driver.hpp"
 #include "Exception.hpp"
+#include "Logging.hpp"
 
 #include <fmt/format.h>
-#include <plog/Log.h>
 
 #include <iostream>
 
@@ -22,56 +22,132 @@ using SoundCath::DriverException;
 
 static const char* const TAG = "Driver::";
 
-#if defined(_WIN32) || defined(_WIN64)
-#define DLL "..\\..\\lib\\asic_call_wrapper_dll64.dll"
+uint32_t Driver::Transfer(const char* command) const {
 
-Driver::Driver() {
+    return transport->Call(command, outbuffer.data());
 
-	this->dll = LoadLibrary(DLL);
-	if (!this->dll) { 
-        PLOGE << TAG << "DLL Not Found or Not Accessable\n";
-        exit(1);
-    }
+}
+
+Driver::Driver(): Driver(MakeDefaultTransport()) {}
+
+Driver::Driver(std::unique_ptr<Transport> transport): transport(std::move(transport)) {
+
+    outbuffer[0] = '\0';
+    iothread = std::thread(&Driver::IOThread, this);
 
-	asic_call_parse = (f_dllfunction)GetProcAddress(this->dll, "asic_call_parse");
-	if (!this->asic_call_parse){ 
-        PLOGE << TAG << "Could Not Access or Find the ASIC Call Function in the DLL\n";
-        exit(1);
-    }
 }
 
-void Driver::Send(const std::string& command) const {
+Driver::~Driver() {
 
-    PLOGD << TAG << "Sending: " << command << '\n';
-    int result = asic_call_parse((char*)command.c_str(), (char*)outbuffer.data());
+    queue.Close(); // whatever is still queued gets sent before the thread exits
+    if(iothread.joinable())
+        iothread.join();
+
+}
+
+void Driver::Dispatch(const char* command) const {
+
+    LOGD("{} Sending: {}\n", TAG, command);
+    const uint32_t result = Transfer(command);
 		
     if (result) {
 
+        LOGE("{} Received Error Code from DLL {}\n", TAG, result);
         DriverError::ThrowErrors((DriverError::Code)result);
-        PLOGE << fmt::format("{} Received Error Code from DLL {}\n", TAG, result);
 
     }
 }
 
-Driver::~Driver() {
+void Driver::Send(const char* command) const {
+
+    const DriverResult<> result = TrySend(command);
+    if(!result)
+        LOGE("{} Received Error Code from DLL {}\n", TAG, uint32_t(result.GetError()));
 
-    Send(CloseCommand());
-	FreeLibrary(this->dll);
+    result.Get();
 
 }
 
-#else
+SoundCath::DriverResult<> Driver::TrySend(const char* command) const {
 
-Driver::~Driver() {}
+    NotFromCallback();
+    queue.WaitIdle(); // anything submitted asynchronously before this has to go out first
+    std::scoped_lock<std::mutex> guard(iolock);
+    LOGD("{} Sending: {}\n", TAG, command);
+    return DriverError::Code(Transfer(command));
 
-void Driver::Send(const std::string& command) const {
+}
+
+std::future<std::string> Driver::SendAsync(std::string command) {
+
+    NotFromCallback();
+
+    Command queued{ std::move(command), {}, {} };
+    std::future<std::string> response = queued.response.get_future();
+
+    if(!queue.Push(std::move(queued)))
+        throw DriverException(DriverError::STATUS);
+
+    return response;
 
-    std::cout << command;
+}
+
+void Driver::SendAsync(std::string command, CommandCallback callback) {
+
+    NotFromCallback();
+
+    if(!queue.Push(Command{ std::move(command), {}, std::move(callback) }))
+        throw DriverException(DriverError::STATUS);
 
 }
-/* The end of the ifdef statement. */
 
-#endif
+void Driver::NotFromCallback() const {
+
+    if(std::this_thread::get_id() == iothread.get_id()) {
+
+        LOGE("{} Called Back Into the Driver From a Callback\n", TAG);
+        throw DriverException(DriverError::STATUS);
+
+    }
+}
+
+void Driver::IOThread() {
+
+    Command command;
+    while(queue.Pop(command)) {
+
+        std::unique_lock<std::mutex> guard(iolock);
+        LOGD("{} Sending Queued: {}\n", TAG, command.command);
+        const uint32_t result = Transfer(command.command.c_str());
+        std::string response(outbuffer.data());
+        guard.unlock();
+
+        if(command.callback) {
+
+            try {
+                command.callback(response, result);
+            }
+            catch(const std::exception& e) {
+                LOGE("{} Command Callback Threw: {}\n", TAG, e.what());
+            }
+
+        }
+        else {
+
+            try {
+                DriverError::ThrowErrors((DriverError::Code)result);
+                command.response.set_value(std::move(response));
+            }
+            catch(...) {
+                command.response.set_exception(std::current_exception());
+            }
+
+        }
+
+        queue.Done();
+
+    }
+}
 
 using SoundCath::DriverError;
 
@@ -112,6 +188,13 @@ const char* DriverError::GetErrorMessage(DriverError::Code error) noexcept{
     }
 }
 
+[[noreturn]] void SoundCath::ThrowError(const DriverError::Code error) {
+
+    DriverError::ThrowErrors(error);
+    throw DriverException(DriverError::FAILED); // an unknown bit, still an error
+
+}
+
 void DriverError::ThrowErrors(const DriverError::Code error) {
 
     if(error & FAILED) throw DriverException(FAILED);
@@ -131,15 +214,31 @@ void DriverError::ThrowErrors(const DriverError::Code error) {
 
 std::string Driver::Query(const std::string& command) const {
 
-    Send(command);
-    return Recv();
+    NotFromCallback();
+    queue.WaitIdle();
+    std::scoped_lock<std::mutex> guard(iolock); // hold the lock so nothing overwrites the response before we copy it
+    Dispatch(command.c_str());
+    std::string output = GetOutString();
+    LOGD("{} Received: {} from Device", TAG, output);
+    return output;
+
+}
+
+std::optional<std::string> Driver::QueryIfIdle(const std::string& command) const {
+
+    std::unique_lock<std::mutex> guard(iolock, std::try_to_lock);
+    if(!guard.owns_lock() || queue.Pending())
+        return std::nullopt;
+
+    Dispatch(command.c_str());
+    return GetOutString();
 
 }
 
 void Driver::Recv(std::string& output) const noexcept {
 
     output = GetOutString();
-    PLOGD << fmt::format("{} Received: {} from Device", TAG, output);
+    LOGD("{} Received: {} from Device", TAG, output);
 
 }
 
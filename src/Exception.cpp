@@ -78,3 +78,14 @@ const char* FPGAException::what() const noexcept {
 
 }
 
+using SoundCath::ConfigException;
+
+ConfigException::ConfigException(std::string message): message(std::move(message)) {
+
+}
+
+const char* ConfigException::what() const noexcept {
+
+    return message.c_str();
+
+}
@@ -9,16 +9,18 @@
  * 
  */
 #include "FPGA.hpp"
+#include "Logging.hpp"
+#include "Status.hpp"
 
 #include <fmt/format.h>
-#include <plog/Log.h>
 #include <iostream>
 
 using SoundCath::FPGA;
 using SoundCath::FPGAError;
 using SoundCath::FPGAParams;
+using SoundCath::DeviceStatus;
 
-static const char* TAG = "FPGA::"
+static const char* TAG = "FPGA::";
 
 const char* FPGAError::GetErrorMessage(const FPGAError::Code error) noexcept {
 
@@ -56,17 +58,8 @@ const char* FPGAError::GetErrorMessage(const FPGAError::Code error) noexcept {
 template<FPGAParams params>
 FPGAError::Code FPGA<params>::GetError() const {
 
-    PLOGD << TAG << "Getting Error Code\n";
-    std::string response = face.Query("GetAsicError");
-    PLOGD << TAG << "Recieved: " << response << '\n';
-
-    // "GetASICError:RESULT:ASIC Error Status: hh, FPGA Error Status: hhhhhhhh" // h is a hex digit
-
-    std::string digits = response.substr(response.size() - 8);
-
-    uint32_t code = std::stoi(digits, 0, 16); // get the integer value from the hex string
-
-    return (FPGAError::Code)code;
+    LOGD("{} Getting Error Code\n", TAG);
+    return DeviceStatus::Query(face).fpga; // the ASIC's status comes back in the same response
 
 }
 
@@ -86,9 +79,10 @@ FPGA<params>::FPGA(Driver& face): face(face) {
 
         
         std::cerr << "Error While Initializing FPGA:: " << e.what();
-        PLOGE << "Error While Initializing FPGA:: " << e.what();
+        LOGE("Error While Initializing FPGA:: {}", e.what());
         exit(1);
 
     }
 }
 
+template class SoundCath::FPGA<SoundCath::FPGAParams{}>;
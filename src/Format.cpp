@@ -0,0 +1,215 @@
+/**
+ * \file Format.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Delay Formatters
+ * \version 0.1
+ * \date 2022-05-06
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Format.hpp"
+#include "Exception.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+using SoundCath::Delays;
+using SoundCath::GroupDelays;
+using SoundCath::QuantDelays;
+using SoundCath::QuantRxDelays;
+using SoundCath::Phases;
+
+namespace {
+
+/// Every Two Digit Pair "00" to "99", Halves the Divisions Compared to Going One Digit at a Time
+constexpr std::array<char, 200> DIGITS = [] {
+
+    std::array<char, 200> digits{};
+    for(size_t i = 0; i < 100; i++) {
+        digits[2 * i] = char('0' + i / 10);
+        digits[2 * i + 1] = char('0' + i % 10);
+    }
+    return digits;
+
+}();
+
+/**
+ * \brief Writes a Delay Between +-\ref DELAY_LIMIT
+ *
+ * \param[in] value: The Delay
+ * \param[out] out: Where to Write
+ * \return char*: One Past the Last Character Written
+ */
+inline char* WriteDelay(int32_t value, char* out) noexcept {
+
+    if(value < 0) {
+        *out++ = '-';
+        value = -value;
+    }
+
+    const uint32_t v = uint32_t(std::min<int32_t>(value, SoundCath::DELAY_LIMIT)); // anything past the limit would run off the table
+    if(v < 10) {
+        *out++ = char('0' + v);
+    }
+    else if(v < 100) {
+        std::memcpy(out, &DIGITS[2 * v], 2);
+        out += 2;
+    }
+    else if(v < 1000) {
+        *out++ = char('0' + v / 100);
+        std::memcpy(out, &DIGITS[2 * (v % 100)], 2);
+        out += 2;
+    }
+    else {
+        std::memcpy(out, &DIGITS[2 * (v / 100)], 2);
+        std::memcpy(out + 2, &DIGITS[2 * (v % 100)], 2);
+        out += 4;
+    }
+
+    return out;
+
+}
+
+/**
+ * \brief Writes a List of Delays Separated by Commas
+ */
+template<typename T, size_t N>
+char* WriteDelays(const std::array<T, N>& delays, char* out) noexcept {
+
+    out = WriteDelay(delays[0], out);
+    for(size_t i = 1; i < N; i++) {
+        *out++ = ',';
+        out = WriteDelay(delays[i], out);
+    }
+
+    return out;
+
+}
+
+/**
+ * \brief Skips Spaces
+ */
+inline const char* SkipSpace(const char* begin, const char* end) noexcept {
+
+    while(begin != end && *begin == ' ')
+        begin++;
+    return begin;
+
+}
+
+/**
+ * \brief Parses One Integer Into a Delay
+ *
+ * \return const char*: One Past the Number, nullptr if There Wasn't One
+ */
+inline const char* ReadDelay(const char* begin, const char* end, double& delay) noexcept {
+
+    int32_t value;
+    const auto [ptr, ec] = std::from_chars(begin, end, value);
+    if(ec != std::errc())
+        return nullptr;
+
+    delay = value;
+    return ptr;
+
+}
+
+/**
+ * \brief Finds Where the Delays Start, Just Past "RESULT[ASIC 0]:"
+ * \throws DriverException: USB_RECEIVE if the Framing is Missing
+ */
+std::string_view Unframe(const std::string_view response) {
+
+    constexpr std::string_view frame("RESULT[ASIC 0]:");
+    const size_t pos = response.find(frame);
+    if(pos == std::string_view::npos)
+        throw SoundCath::DriverException(SoundCath::DriverError::USB_RECEIVE);
+
+    return response.substr(pos + frame.size());
+
+}
+
+}
+
+char* SoundCath::FormatDelays(const Delays& delays, char* out) noexcept {
+
+    QuantDelays quantized;
+    QuantizeDelays(delays, quantized);
+    return WriteDelays(quantized, out);
+
+}
+
+char* SoundCath::FormatDelays(const QuantDelays& delays, char* out) noexcept {
+
+    return WriteDelays(delays, out);
+
+}
+
+char* SoundCath::FormatDelays(const QuantRxDelays& delays, char* out) noexcept {
+
+    return WriteDelays(delays, out);
+
+}
+
+char* SoundCath::FormatDelays(const GroupDelays& delays, char* out) noexcept {
+
+    return WriteDelays(delays, out);
+
+}
+
+bool SoundCath::ParseDelays(const std::string_view list, Delays& delays) noexcept {
+
+    const char* it = list.data();
+    const char* const end = list.data() + list.size();
+
+    for(size_t i = 0; i < delays.size(); i++) {
+
+        if(i) { // every delay but the first needs a separator in front
+            it = SkipSpace(it, end);
+            if(it == end || *it != ',')
+                return false;
+            it++;
+        }
+
+        it = ReadDelay(SkipSpace(it, end), end, delays[i]);
+        if(!it)
+            return false;
+
+    }
+
+    return SkipSpace(it, end) == end; // anything left means there were too many
+
+}
+
+void SoundCath::ParseTxDelays(const std::string_view response, Delays& delays) {
+
+    if(!ParseDelays(Unframe(response), delays))
+        throw DriverException(DriverError::USB_RECEIVE);
+
+}
+
+void SoundCath::ParseRxDelays(const std::string_view response, Delays& delays, Phases& phases) {
+
+    const std::string_view list = Unframe(response);
+    const char* it = list.data();
+    const char* const end = list.data() + list.size();
+
+    for(size_t i = 0; i < delays.size(); i++) {
+
+        it = ReadDelay(SkipSpace(it, end), end, delays[i]);
+        if(!it || it == end || *it != '/')
+            throw DriverException(DriverError::USB_RECEIVE);
+
+        it = ReadDelay(it + 1, end, phases[i]);
+        if(!it || (it != end && *it != ' '))
+            throw DriverException(DriverError::USB_RECEIVE);
+
+    }
+
+    if(SkipSpace(it, end) != end)
+        throw DriverException(DriverError::USB_RECEIVE);
+
+}
@@ -0,0 +1,309 @@
+/**
+ * \file Kernels.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Vectorized Delay Kernels
+ * \version 0.1
+ * \date 2022-05-12
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Kernels.hpp"
+#include "SIMD.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+using SoundCath::TxDelayKernel;
+using SoundCath::TaylorKernel;
+using SoundCath::FocalPoint;
+using SoundCath::Delays;
+using SoundCath::QuantDelays;
+using SoundCath::QuantPhases;
+using SoundCath::TxCoeffs;
+using SoundCath::RxCoeffs;
+
+TxDelayKernel::TxDelayKernel(const TransducerParams& tparams, const double delay_res_ns):
+    numelements(std::min<size_t>(size_t(tparams.ygroups) * tparams.xgroups * tparams.elempergroup, 16 * 64)),
+    scale(1.0 / (tparams.soundspeed * delay_res_ns * 1e-9)) {
+
+    xel.fill(0.0f);
+    yel.fill(0.0f);
+
+    // same layout and geometry as TXController::CalculateDelays
+    for(int yg = 0; yg < tparams.ygroups; yg++) {
+
+        const double ygroup = (yg - tparams.ygroups/2 - .5) * tparams.group_pitch_nm * 1e-9;
+        for(int xg = 0; xg < tparams.xgroups; xg++) {
+
+            const double xgroup = (xg - tparams.xgroups/2 - .5) * tparams.group_pitch_nm * 1e-9;
+            const size_t igroup = yg * tparams.xgroups + xg;
+
+            for(int elx = 0; elx < tparams.xelems; elx++) {
+                for(int ely = 0; ely < tparams.yelems; ely++) {
+
+                    const size_t el = elx * tparams.yelems + ely + igroup * tparams.elempergroup;
+                    if(el >= xel.size())
+                        continue;
+
+                    xel[el] = float(xgroup + (elx - tparams.xelems/2 - .5) * tparams.pitch_nm * 1e-9);
+                    yel[el] = float(ygroup + (ely - tparams.yelems/2 - .5) * tparams.pitch_nm * 1e-9);
+
+                }
+            }
+        }
+    }
+}
+
+void TxDelayKernel::Calculate(const FocalPoint& focus, Delays& delays) const noexcept {
+
+    const float x = float(focus.x);
+    const float y = float(focus.y);
+    const float z2 = float(focus.z * focus.z);
+    const float r = float(std::sqrt(focus.x * focus.x + focus.y * focus.y + focus.z * focus.z));
+
+    alignas(64) std::array<float, 16 * 64> raw;  // r - distance, in meters
+    size_t i = 0;
+
+    const SIMD::Floats vx = SIMD::Set(x), vy = SIMD::Set(y), vz2 = SIMD::Set(z2), vr = SIMD::Set(r);
+    SIMD::Floats vmin = SIMD::Set(INFINITY);
+    for(; i + SIMD::WIDTH <= numelements; i += SIMD::WIDTH) {
+
+        const SIMD::Floats dx = SIMD::Sub(vx, SIMD::Load(&xel[i]));
+        const SIMD::Floats dy = SIMD::Sub(vy, SIMD::Load(&yel[i]));
+        const SIMD::Floats diff = SIMD::Sub(vr, SIMD::Sqrt(SIMD::Add(SIMD::Add(SIMD::Mul(dx, dx), SIMD::Mul(dy, dy)), vz2)));
+        vmin = SIMD::Min(vmin, diff);
+        SIMD::Store(&raw[i], diff);
+
+    }
+
+    float least = SIMD::ReduceMin(vmin);
+
+    for(; i < numelements; i++) { // the tail, past the last whole vector
+
+        const float dx = x - xel[i];
+        const float dy = y - yel[i];
+        raw[i] = r - std::sqrt(dx * dx + dy * dy + z2);
+        least = std::min(least, raw[i]);
+
+    }
+
+    if(numelements < delays.size()) // the unused elements sit at 0, like in TXController::CalculateDelays
+        least = std::min(least, 0.0f);
+
+    // shift so the earliest element fires at 0, the compiler vectorizes this one on its own
+    for(size_t j = 0; j < numelements; j++)
+        delays[j] = (double(raw[j]) - double(least)) * scale;
+
+    std::fill(delays.begin() + numelements, delays.end(), 0.0);
+
+}
+
+void TxDelayKernel::Calculate(const FocalPoint* foci, Delays* delays, const size_t count) const noexcept {
+
+    for(size_t i = 0; i < count; i++)
+        Calculate(foci[i], delays[i]);
+
+}
+
+void TxDelayKernel::Calculate(const FocalPoint* foci, Delays* delays, const size_t count, ThreadPool& pool) const {
+
+    constexpr size_t BATCH = 16; // enough beams per index that handing them out costs nothing
+    pool.ParallelFor((count + BATCH - 1) / BATCH, [=, this](const size_t batch) {
+        const size_t start = batch * BATCH;
+        Calculate(foci + start, delays + start, std::min(BATCH, count - start));
+    });
+
+}
+
+/// X of Each Element in its Group, Offset by -0.5 Like the Spec
+alignas(64) static constexpr int32_t XLOCAL[16] = { -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1 };
+
+/// Y of Each Element in its Group, Offset by -0.5 Like the Spec
+alignas(64) static constexpr int32_t YLOCAL[16] = { -2, -1, 0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1, 0, 1 };
+
+#if defined(__AVX2__) && !defined(__AVX512F__)
+
+/**
+ * \brief Packs Two Vectors of 8 int32 Into 16 int16, in Order
+ */
+static inline __m256i Pack16(const __m256i low, const __m256i high) noexcept {
+
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8); // packs works per 128 bit lane, put the lanes back in order
+
+}
+
+#endif
+
+void TaylorKernel::UncompressTx(const TxCoeffs& coeffs, QuantDelays& delays) noexcept {
+
+    const int32_t c[8] = { coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4], coeffs[5], coeffs[6], coeffs[7] };
+
+#if defined(__AVX512F__)
+    const __m512i vxl = _mm512_load_si512(XLOCAL), vyl = _mm512_load_si512(YLOCAL);
+#elif defined(__AVX2__)
+    const __m256i vxl0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(XLOCAL)), vxl1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(XLOCAL + 8));
+    const __m256i vyl0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(YLOCAL)), vyl1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(YLOCAL + 8));
+#endif
+
+    for(int32_t y = 0; y < GROUPS_Y; y++) {
+
+        const int32_t y0 = y + GROUP_OFFSET_Y;
+
+        // the group terms for a whole row, same steps as TXController::UncompressTaylor, plain loops the compiler vectorizes
+        alignas(64) int32_t groups[GROUPS_X], dxs[GROUPS_X], dys[GROUPS_X];
+
+        const int32_t rowgroup = c[0] * (1 << TX_FP) + ((c[4] * TX_LINEAR[y0]) >> TX_FP) + ((c[5] * TX_SQUARE[y0]) >> TX_FP) + ((c[6] * TX_CUBE[y0]) >> TX_FP);
+        const int32_t rowdy = c[4] * (1 << (TX_FP + 1)) + ((c[5] * TX_LINEAR[y0]) >> TX_FP) + ((c[6] * TX_SQUARE[y0]) >> TX_FP);
+        const int32_t rowdx = c[1] * (1 << (TX_FP + 1)) + ((c[7] * TX_LINEAR[y0]) >> TX_FP);
+
+        for(int32_t x = 0; x < GROUPS_X; x++) {
+
+            int32_t group = rowgroup + ((c[1] * TX_LINEAR[x]) >> TX_FP) + ((c[2] * TX_SQUARE[x]) >> TX_FP) + ((c[3] * TX_CUBE[x]) >> TX_FP);
+            group += (c[7] * TX_LINEARXY[x] * TX_LINEARXY[y0]) >> (TX_FP + 1);
+            groups[x] = (std::max(group, 0) >> TX_FP) & 0x1FF;
+
+            dys[x] = std::clamp((rowdy + ((c[7] * TX_LINEAR[x]) >> TX_FP)) >> (TX_FP + 1), -128, 127);
+            dxs[x] = std::clamp((rowdx + ((c[2] * TX_LINEAR[x]) >> TX_FP) + ((c[3] * TX_SQUARE[x]) >> TX_FP)) >> (TX_FP + 1), -128, 127);
+
+        }
+
+        for(int32_t x = 0; x < GROUPS_X; x++) {
+
+            const int32_t group = groups[x], dx = dxs[x], dy = dys[x];
+            const int32_t center = 16 * (1 << TX_FP) - (group % 2 == 0 ? 1 << TX_FP : 0) + (dx >> 2) + (dy >> 2);
+            const int32_t coarse = group & ~1;
+            int16_t* out = delays.data() + (y * GROUPS_X + x) * 16;
+
+#if defined(__AVX512F__)
+
+            __m512i element = _mm512_add_epi32(_mm512_set1_epi32(center), _mm512_srai_epi32(_mm512_mullo_epi32(vxl, _mm512_set1_epi32(dx)), 1));
+            element = _mm512_srai_epi32(_mm512_add_epi32(element, _mm512_srai_epi32(_mm512_mullo_epi32(vyl, _mm512_set1_epi32(dy)), 1)), TX_FP);
+            element = _mm512_mask_mov_epi32(element, _mm512_cmpge_epi32_mask(element, _mm512_set1_epi32(TX_ELEMENT_MAX)), _mm512_set1_epi32(TX_INVALID));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm512_cvtepi32_epi16(_mm512_add_epi32(element, _mm512_set1_epi32(coarse))));
+
+#elif defined(__AVX2__)
+
+            const __m256i vcenter = _mm256_set1_epi32(center), vdx = _mm256_set1_epi32(dx), vdy = _mm256_set1_epi32(dy);
+            const __m256i vlimit = _mm256_set1_epi32(TX_ELEMENT_MAX - 1), vinvalid = _mm256_set1_epi32(TX_INVALID), vcoarse = _mm256_set1_epi32(coarse);
+
+            __m256i half[2];
+            for(int h = 0; h < 2; h++) {
+
+                __m256i element = _mm256_add_epi32(vcenter, _mm256_srai_epi32(_mm256_mullo_epi32(h ? vxl1 : vxl0, vdx), 1));
+                element = _mm256_srai_epi32(_mm256_add_epi32(element, _mm256_srai_epi32(_mm256_mullo_epi32(h ? vyl1 : vyl0, vdy), 1)), TX_FP);
+                element = _mm256_blendv_epi8(element, vinvalid, _mm256_cmpgt_epi32(element, vlimit));
+                half[h] = _mm256_add_epi32(element, vcoarse);
+
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), Pack16(half[0], half[1]));
+
+#else
+
+            for(int32_t e = 0; e < 16; e++) {
+
+                int32_t element = (center + ((XLOCAL[e] * dx) >> 1) + ((YLOCAL[e] * dy) >> 1)) >> TX_FP;
+                if(element >= TX_ELEMENT_MAX)
+                    element = TX_INVALID;
+
+                out[e] = int16_t(coarse + element);
+
+            }
+
+#endif
+
+        }
+    }
+}
+
+void TaylorKernel::UncompressRx(const RxCoeffs& coeffs, QuantDelays& delays, QuantPhases& phases) noexcept {
+
+    const int32_t c[10] = { coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4], coeffs[5], coeffs[6], coeffs[7], coeffs[8], coeffs[9] };
+
+    // the part of the delay that only depends on where the element is in its group, the same for every group
+    const int32_t base = 14 * 8 + (c[7] >> 2) + (c[8] >> 2) + 4 - (RX_CURVES - 1) * c[9];
+    alignas(64) int32_t local[16];
+    for(int32_t e = 0; e < 16; e++)
+        local[e] = base + ((c[7] * XLOCAL[e]) >> 1) + ((c[8] * YLOCAL[e]) >> 1);
+
+#if defined(__AVX512F__)
+    const __m512i vxl = _mm512_load_si512(XLOCAL), vyl = _mm512_load_si512(YLOCAL), vlocal = _mm512_load_si512(local);
+    const __m512i vstep = _mm512_set1_epi32(2 * c[9]), vmax = _mm512_set1_epi32(RX_CURVES - 1), vzero = _mm512_setzero_si512();
+#elif defined(__AVX2__)
+    const __m256i vxl[2] = { _mm256_load_si256(reinterpret_cast<const __m256i*>(XLOCAL)), _mm256_load_si256(reinterpret_cast<const __m256i*>(XLOCAL + 8)) };
+    const __m256i vyl[2] = { _mm256_load_si256(reinterpret_cast<const __m256i*>(YLOCAL)), _mm256_load_si256(reinterpret_cast<const __m256i*>(YLOCAL + 8)) };
+    const __m256i vlocal[2] = { _mm256_load_si256(reinterpret_cast<const __m256i*>(local)), _mm256_load_si256(reinterpret_cast<const __m256i*>(local + 8)) };
+    const __m256i vstep = _mm256_set1_epi32(2 * c[9]), vmax = _mm256_set1_epi32(RX_CURVES - 1), vzero = _mm256_setzero_si256();
+#endif
+
+    for(int32_t y = 0; y < GROUPS_Y; y++) {
+
+        const int32_t y0 = y + GROUP_OFFSET_Y;
+
+        // same steps as RXController::UncompressTaylor for a whole row, the assignment has 4 * 8 taken back off up front
+        alignas(64) int32_t dxs[GROUPS_X], dys[GROUPS_X];
+        const int32_t rowdy = c[3] + ((c[4] * RX_LINEAR[y0]) >> 5) + ((c[5] * RX_SQUARE[y0]) >> 5);
+
+        for(int32_t x = 0; x < GROUPS_X; x++) {
+
+            dxs[x] = (c[0] + ((c[1] * RX_LINEAR[x]) >> 5) + ((c[2] * RX_SQUARE[x]) >> 5)) >> 1;
+            dys[x] = (rowdy + ((c[6] * RX_LINEAR[x]) >> 5)) >> 1;
+
+        }
+
+        for(int32_t x = 0; x < GROUPS_X; x++) {
+
+            const int32_t dx = dxs[x], dy = dys[x];
+            const int32_t center = 8 * 8 - 4 * 8 + (dx >> 2) + (dy >> 2);
+
+            const int32_t first = (y * GROUPS_X + x) * 16;
+
+#if defined(__AVX512F__)
+
+            __m512i assign = _mm512_add_epi32(_mm512_set1_epi32(center), _mm512_srai_epi32(_mm512_mullo_epi32(vxl, _mm512_set1_epi32(dx)), 1));
+            assign = _mm512_add_epi32(assign, _mm512_srai_epi32(_mm512_mullo_epi32(vyl, _mm512_set1_epi32(dy)), 1));
+            const __m512i phase = _mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(assign, 3), vzero), vmax);
+            const __m512i delay = _mm512_srai_epi32(_mm512_add_epi32(vlocal, _mm512_mullo_epi32(phase, vstep)), 3);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(phases.data() + first), _mm512_cvtepi32_epi8(phase));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(delays.data() + first), _mm512_cvtepi32_epi16(delay));
+
+#elif defined(__AVX2__)
+
+            const __m256i vcenter = _mm256_set1_epi32(center), vdx = _mm256_set1_epi32(dx), vdy = _mm256_set1_epi32(dy);
+
+            __m256i phase[2], delay[2];
+            for(int h = 0; h < 2; h++) {
+
+                __m256i assign = _mm256_add_epi32(vcenter, _mm256_srai_epi32(_mm256_mullo_epi32(vxl[h], vdx), 1));
+                assign = _mm256_add_epi32(assign, _mm256_srai_epi32(_mm256_mullo_epi32(vyl[h], vdy), 1));
+                phase[h] = _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(assign, 3), vzero), vmax);
+                delay[h] = _mm256_srai_epi32(_mm256_add_epi32(vlocal[h], _mm256_mullo_epi32(phase[h], vstep)), 3);
+
+            }
+
+            const __m256i phase16 = Pack16(phase[0], phase[1]);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(phases.data() + first), _mm_packs_epi16(_mm256_castsi256_si128(phase16), _mm256_extracti128_si256(phase16, 1)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(delays.data() + first), Pack16(delay[0], delay[1]));
+
+#else
+
+            for(int32_t e = 0; e < 16; e++) {
+
+                const int32_t phase = std::clamp((center + ((dx * XLOCAL[e]) >> 1) + ((dy * YLOCAL[e]) >> 1)) >> 3, 0, RX_CURVES - 1);
+                phases[first + e] = int8_t(phase);
+                delays[first + e] = int16_t((local[e] + phase * 2 * c[9]) >> 3);
+
+            }
+
+#endif
+
+        }
+    }
+}
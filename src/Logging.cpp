@@ -0,0 +1,127 @@
+/**
+ * \file Logging.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Asynchronous File Appender
+ * \version 0.1
+ * \date 2022-05-15
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Logging.hpp"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <plog/Init.h>
+#include <plog/Formatters/TxtFormatter.h>
+
+using SoundCath::AsyncAppender;
+
+AsyncAppender::AsyncAppender(const std::filesystem::path& path, const size_t capacity):
+    file(path, std::ios::out | std::ios::app), capacity(std::max<size_t>(capacity, 1)), writer(&AsyncAppender::Run, this) {
+
+}
+
+AsyncAppender::~AsyncAppender() {
+
+    {
+        std::scoped_lock<std::mutex> guard(lock);
+        stop = true;
+    }
+
+    queued.notify_one();
+    writer.join();
+
+}
+
+void AsyncAppender::write(const plog::Record& record) {
+
+    auto line = plog::TxtFormatter::format(record);
+
+    {
+        std::scoped_lock<std::mutex> guard(lock);
+        if(lines.size() >= capacity) {
+
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+
+        }
+
+        lines.push_back(std::move(line));
+    }
+
+    queued.notify_one();
+
+}
+
+void AsyncAppender::Flush() {
+
+    std::unique_lock<std::mutex> guard(lock);
+    written.wait(guard, [this] { return lines.empty() && !writing; });
+
+}
+
+void AsyncAppender::Reopen(const std::filesystem::path& path) {
+
+    // the writer only touches the file while it has lines out of the queue, so once it is idle the file is ours
+    std::unique_lock<std::mutex> guard(lock);
+    written.wait(guard, [this] { return lines.empty() && !writing; });
+
+    file.close();
+    file.open(path, std::ios::out | std::ios::app);
+
+}
+
+void AsyncAppender::Run() {
+
+    std::vector<plog::util::nstring> batch;
+
+    std::unique_lock<std::mutex> guard(lock);
+    while(true) {
+
+        queued.wait(guard, [this] { return stop || !lines.empty(); });
+        if(lines.empty()) // stopping and everything is written
+            break;
+
+        batch.assign(std::make_move_iterator(lines.begin()), std::make_move_iterator(lines.end()));
+        lines.clear();
+        writing = true;
+
+        guard.unlock();
+
+        for(const auto& line: batch)
+            file << line;
+        file.flush();
+        batch.clear();
+
+        guard.lock();
+        writing = false;
+        written.notify_all();
+
+    }
+}
+
+void SoundCath::InitLogging(const std::filesystem::path& path, const plog::Severity severity) {
+
+    static std::mutex initlock;
+    static AsyncAppender* appender = nullptr;
+    std::scoped_lock<std::mutex> guard(initlock);
+
+    if(!appender) {
+
+        static AsyncAppender file(path);
+        plog::init(severity, &file);
+        appender = &file;
+
+    }
+    else { // plog keeps the first appender, so that one moves to the new file
+
+        appender->Reopen(path);
+        plog::get()->setMaxSeverity(severity);
+
+    }
+
+}
@@ -0,0 +1,138 @@
+/**
+ * \file MappedFile.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Read Only Memory Mapped File
+ * \version 0.1
+ * \date 2022-05-13
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using SoundCath::MappedFile;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& path) noexcept {
+
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER length;
+    if(GetFileSizeEx(file, &length) && length.QuadPart > 0) {
+
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping) {
+
+            data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = data ? size_t(length.QuadPart) : 0;
+
+            if(!data) {
+                CloseHandle(mapping);
+                mapping = nullptr;
+            }
+        }
+    }
+
+    CloseHandle(file); // the mapping keeps the file open
+
+}
+
+void MappedFile::Close() noexcept {
+
+    if(data)
+        UnmapViewOfFile(data);
+
+    if(mapping)
+        CloseHandle(mapping);
+
+    data = nullptr;
+    mapping = nullptr;
+    size = 0;
+
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& path) noexcept {
+
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+        return;
+
+    struct stat info;
+    if(fstat(fd, &info) == 0 && info.st_size > 0) {
+
+        void* mapped = mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if(mapped != MAP_FAILED) {
+
+            data = static_cast<const std::byte*>(mapped);
+            size = size_t(info.st_size);
+
+        }
+    }
+
+    close(fd); // the mapping keeps the file open
+
+}
+
+void MappedFile::Close() noexcept {
+
+    if(data)
+        munmap(const_cast<std::byte*>(data), size);
+
+    data = nullptr;
+    size = 0;
+
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+
+    Close();
+
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept:
+    data(std::exchange(other.data, nullptr)),
+    size(std::exchange(other.size, 0))
+#ifdef _WIN32
+    , mapping(std::exchange(other.mapping, nullptr))
+#endif
+{
+
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+
+    if(this != &other) {
+
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+#ifdef _WIN32
+        mapping = std::exchange(other.mapping, nullptr);
+#endif
+
+    }
+
+    return *this;
+
+}
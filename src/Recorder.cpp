@@ -0,0 +1,149 @@
+/**
+ * \file Recorder.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Recording and Replay Transports
+ * \version 0.1
+ * \date 2022-05-17
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Recorder.hpp"
+#include "Driver.hpp"
+#include "Exception.hpp"
+#include "Logging.hpp"
+
+#include <cstring>
+#include <thread>
+#include <utility>
+
+using SoundCath::Recording;
+using SoundCath::RecordingTransport;
+using SoundCath::ReplayTransport;
+using SoundCath::DriverException;
+using SoundCath::DriverError;
+
+static const char* const TAG = "Recorder::";
+
+RecordingTransport::RecordingTransport(std::unique_ptr<Transport> transport, const std::filesystem::path& path):
+    transport(std::move(transport)), file(path, std::ios::binary | std::ios::trunc), start(std::chrono::steady_clock::now()) {
+
+    const Recording::Header header{ Recording::MAGIC, Recording::VERSION };
+    if(!file.write(reinterpret_cast<const char*>(&header), sizeof(header))) {
+
+        LOGE("{} Couldn't Create the Recording {}\n", TAG, path.string());
+        throw DriverException(DriverError::SWINTERNAL);
+
+    }
+}
+
+RecordingTransport::~RecordingTransport() {
+
+    file.flush();
+
+}
+
+uint32_t RecordingTransport::Call(const char* command, char* output) {
+
+    const auto sent = std::chrono::steady_clock::now();
+    const uint32_t result = transport->Call(command, output);
+    const auto answered = std::chrono::steady_clock::now();
+
+    Recording::Record record{};
+    record.start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(sent - start).count();
+    record.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(answered - sent).count();
+    record.result = result;
+    record.commandsize = uint32_t(std::strlen(command));
+    record.responsesize = uint32_t(std::strlen(output));
+
+    file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    file.write(command, record.commandsize);
+    file.write(output, record.responsesize);
+    count++;
+
+    return result;
+
+}
+
+ReplayTransport::ReplayTransport(const std::filesystem::path& path, const Config& config): file(path), config(config) {
+
+    if(!file.IsOpen() || file.GetSize() < sizeof(Recording::Header)) {
+
+        LOGE("{} Couldn't Open the Recording {}\n", TAG, path.string());
+        throw DriverException(DriverError::SWINTERNAL);
+
+    }
+
+    const char* const data = reinterpret_cast<const char*>(file.GetData());
+    const size_t size = file.GetSize();
+
+    Recording::Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if(header.magic != Recording::MAGIC || header.version != Recording::VERSION) {
+
+        LOGE("{} {} isn't a Recording or is From Another Version\n", TAG, path.string());
+        throw DriverException(DriverError::SWINTERNAL);
+
+    }
+
+    // a recording cut short by a crash still plays up to the last whole call
+    size_t offset = sizeof(header);
+    while(size - offset >= sizeof(Recording::Record)) {
+
+        Recording::Record record;
+        std::memcpy(&record, data + offset, sizeof(record));
+        offset += sizeof(record);
+
+        if(size - offset < size_t(record.commandsize) + record.responsesize || record.responsesize >= UINT16_MAX)
+            break;
+
+        entries.push_back({
+            std::string_view(data + offset, record.commandsize),
+            std::string_view(data + offset + record.commandsize, record.responsesize),
+            std::chrono::nanoseconds(record.duration_ns),
+            record.result
+        });
+
+        offset += record.commandsize + record.responsesize;
+
+    }
+
+    if(offset != size)
+        LOGW("{} {} Ends Part Way Through a Call, Playing the First {}\n", TAG, path.string(), entries.size());
+
+}
+
+uint32_t ReplayTransport::Call(const char* command, char* output) {
+
+    if(next >= entries.size()) {
+
+        LOGE("{} Ran Past the End of the Recording on {}\n", TAG, command);
+        output[0] = '\0';
+        return DriverError::USB_RECEIVE;
+
+    }
+
+    const auto called = std::chrono::steady_clock::now();
+    const Entry& entry = entries[next++];
+
+    if(entry.command != command) {
+
+        mismatches++;
+        LOGW("{} Call {} Was {} When Recorded, Got {}\n", TAG, next - 1, entry.command, command);
+
+        if(config.strict) {
+            output[0] = '\0';
+            return DriverError::PARAM;
+        }
+    }
+
+    std::memcpy(output, entry.response.data(), entry.response.size());
+    output[entry.response.size()] = '\0';
+
+    if(config.paced)
+        std::this_thread::sleep_until(called + entry.duration);
+
+    return entry.result;
+
+}
@@ -0,0 +1,57 @@
+/**
+ * \file RegisterShadow.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Register Shadow
+ * \version 0.1
+ * \date 2022-05-16
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "RegisterShadow.hpp"
+
+#include <utility>
+
+using SoundCath::RegisterShadow;
+
+void RegisterShadow::Commit(std::string key, std::string value) {
+
+    values.insert_or_assign(std::move(key), std::move(value));
+
+}
+
+void RegisterShadow::Invalidate(const std::string_view key) {
+
+    const auto entry = values.find(key);
+    if(entry != values.end())
+        values.erase(entry);
+
+}
+
+std::vector<RegisterShadow::Change> RegisterShadow::Diff(const RegisterShadow& target) const {
+
+    std::vector<Change> changes;
+
+    // both maps are sorted, so one pass over each finds every key that is new or different
+    auto mine = values.begin();
+    for(const auto& [key, value]: target.values) {
+
+        while(mine != values.end() && mine->first < key)
+            ++mine;
+
+        if(mine == values.end() || mine->first != key || mine->second != value)
+            changes.push_back({ key, value });
+
+    }
+
+    return changes;
+
+}
+
+const std::string* RegisterShadow::Get(const std::string_view group, const std::string_view param) const {
+
+    const auto entry = values.find(fmt::format("{},{}", group, param));
+    return entry == values.end() ? nullptr : &entry->second;
+
+}
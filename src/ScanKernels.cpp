@@ -0,0 +1,141 @@
+/**
+ * \file ScanKernels.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Probe Table and the Compile Time Specialized Beam Kernels
+ * \version 0.1
+ * \date 2022-05-22
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "ScanKernels.hpp"
+#include "Exception.hpp"
+#include "Preset.hpp"
+#include "Logging.hpp"
+
+#include <array>
+#include <algorithm>
+
+using SoundCath::ScanKernels;
+using SoundCath::RuntimeScanData;
+using SoundCath::TransducerParams;
+using SoundCath::ControllerParams;
+using SoundCath::BeamGeometry;
+using SoundCath::TXController;
+using SoundCath::RXController;
+using SoundCath::ConfigException;
+
+static const char* const TAG = "ScanKernels::";
+
+/// Calculates One Beam of the Scan
+typedef void (*BeamKernel)(const ControllerParams& params, RuntimeScanData& data, const int i, const int j);
+
+/**
+ * \brief Calculates One Beam, the Same Math as Controller::CalcBeam With the Scan Area Taken at Runtime
+ *
+ * \tparam tx: The Tx Lookup Parameters
+ * \tparam rx: The Rx Lookup Parameters
+ * \tparam tparams: The Transducer
+ */
+template<ControllerParams::TxParams tx, ControllerParams::RxParams rx, TransducerParams tparams>
+static void CalcBeam(const ControllerParams& params, RuntimeScanData& data, const int i, const int j) {
+
+    const BeamGeometry beam = SoundCath::GetBeamGeometry(params, i, j);
+    const size_t index = i + j * size_t(params.x_steps);
+
+    if(!params.usedelays) {
+
+        const auto taylor = TXController<tx, tparams>::CompressTaylor(beam.txx, beam.txy, beam.txz, 0);
+        data.txcoeffs[index] = taylor.coeffs;
+        data.rxcoeffs[index] = RXController<rx, tparams>::CompressTaylor(beam.txx, beam.txy, beam.txz);
+        data.txoffsets[index] = taylor.beamoffset_s;
+        data.rxgroupdelays[index] = RXController<rx, tparams>::CalculateDelays(beam.x_deg, beam.y_deg).groupdelays;
+
+    }
+    else {
+
+        const auto rxdelays = RXController<rx, tparams>::CalculateDelays(beam.x_deg, beam.y_deg);
+        SoundCath::QuantizeDelays(TXController<tx, tparams>::CalculateDelays(beam.txx, beam.txy, beam.txz), data.txdelays[index]);
+        SoundCath::QuantizeDelays(rxdelays.delays, data.rxdelays[index]);
+        data.rxgroupdelays[index] = rxdelays.groupdelays;
+
+    }
+}
+
+/// A Probe Geometry With a Kernel Compiled for it
+struct Probe {
+
+    TransducerParams tparams;           ///< The Transducer
+    ControllerParams::TxParams tx;      ///< The Tx Lookup Parameters
+    ControllerParams::RxParams rx;      ///< The Rx Lookup Parameters
+    BeamKernel kernel;                  ///< Calculates a Beam for This Geometry
+
+};
+
+/// Builds the Table Entry for a Probe
+template<TransducerParams tparams, ControllerParams::TxParams tx = ControllerParams::TxParams{}, ControllerParams::RxParams rx = ControllerParams::RxParams{}>
+static constexpr Probe MakeProbe() noexcept {
+
+    return { tparams, tx, rx, &CalcBeam<tx, rx, tparams> };
+
+}
+
+/// Every Probe This Build Can Scan With, Each Line Compiles One Set of Kernels so Only Add the Ones That Ship
+static constexpr std::array PROBES = {
+
+    MakeProbe<TransducerParams{}>(),
+    MakeProbe<SoundCath::PRESET.trparams, SoundCath::PRESET.conparams.txparams, SoundCath::PRESET.conparams.rxparams>() // the build's preset always has one
+
+};
+
+/// Finds the Probe Matching a Geometry, nullptr if There Isn't One
+static const Probe* FindProbe(const TransducerParams& tparams, const ControllerParams& params) noexcept {
+
+    const auto probe = std::find_if(PROBES.begin(), PROBES.end(), [&](const Probe& probe) {
+        return probe.tparams == tparams && probe.tx == params.txparams && probe.rx == params.rxparams;
+    });
+
+    return probe == PROBES.end() ? nullptr : &*probe;
+
+}
+
+bool ScanKernels::Supports(const TransducerParams& tparams, const ControllerParams& params) noexcept {
+
+    return FindProbe(tparams, params) != nullptr;
+
+}
+
+std::unique_ptr<RuntimeScanData> ScanKernels::CalcScanData(const TransducerParams& tparams, const ControllerParams& params, ThreadPool& pool) {
+
+    const Probe* const probe = FindProbe(tparams, params);
+    if(!probe) {
+
+        LOGE("{} No Kernel for the Probe Geometry, {} Elements With {} Groups\n", TAG, tparams.numelements, tparams.numgroups);
+        throw ConfigException("No Scan Kernel is Built for This Probe Geometry, Add it to the Probe Table");
+
+    }
+
+    auto data = std::make_unique<RuntimeScanData>();
+    data->usedelays = params.usedelays;
+    data->beams = size_t(params.x_steps) * params.y_steps;
+
+    if(params.usedelays) {
+        data->txdelays.resize(data->beams);
+        data->rxdelays.resize(data->beams);
+    }
+    else {
+        data->txcoeffs.resize(data->beams);
+        data->rxcoeffs.resize(data->beams);
+        data->txoffsets.resize(data->beams);
+    }
+    data->rxgroupdelays.resize(data->beams);
+
+    const BeamKernel kernel = probe->kernel;
+    pool.ParallelFor(data->beams, [&](const size_t beam) {
+        kernel(params, *data, int(beam % params.x_steps), int(beam / params.x_steps));
+    });
+
+    return data;
+
+}
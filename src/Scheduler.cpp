@@ -0,0 +1,109 @@
+/**
+ * \file Scheduler.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Command Scheduler
+ * \version 0.1
+ * \date 2022-05-21
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Scheduler.hpp"
+#include "Status.hpp"
+#include "Logging.hpp"
+
+#include <algorithm>
+#include <thread>
+
+using SoundCath::Scheduler;
+using SoundCath::DriverError;
+using SoundCath::ASICError;
+using SoundCath::FPGAError;
+using SoundCath::DeviceStatus;
+
+static const char* const TAG = "Scheduler::";
+
+/// Nanoseconds on the Steady Clock, What the Resume Time is Kept in
+static int64_t Now() noexcept {
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+}
+
+Scheduler::Scheduler(Driver& driver, const Config& config): driver(driver), config(config) {
+
+}
+
+std::optional<Scheduler::Cause> Scheduler::Classify(const DriverError::Code error) const {
+
+    constexpr uint32_t devicebits = DriverError::ASICERROR | DriverError::FPGAERROR;
+    if(!(error & devicebits) || (error & ~devicebits)) // the link or the command itself is bad, trying again won't help
+        return std::nullopt;
+
+    std::optional<DeviceStatus> status;
+    try {
+        status = DeviceStatus::Query(driver);
+    }
+    catch(const std::exception& e) {
+        LOGW("{} Couldn't Read the Status After a Failure: {}\n", TAG, e.what());
+        return std::nullopt;
+    }
+
+    constexpr uint32_t transientfpga = FPGAError::CLKBUSY | FPGAError::OVERFULL;
+    if((status->asic & ~ASICError::BUSY) || (status->fpga & ~transientfpga) || status->IsOk())
+        return std::nullopt;
+
+    // the slowest to clear goes first, a full queue takes longer to drain than a busy clock
+    if(status->fpga & FPGAError::OVERFULL)
+        return FPGA_OVERFULL;
+    if(status->fpga & FPGAError::CLKBUSY)
+        return FPGA_CLKBUSY;
+
+    return ASIC_BUSY;
+
+}
+
+void Scheduler::Throttle(const Cause cause) {
+
+    retries[cause].fetch_add(1, std::memory_order_relaxed);
+
+    int64_t current = backoff[cause].load(std::memory_order_relaxed), grown;
+    do {
+        grown = std::clamp<int64_t>(current * 2, config.minbackoff.count(), config.maxbackoff.count());
+    } while(!backoff[cause].compare_exchange_weak(current, grown, std::memory_order_relaxed));
+
+    const int64_t until = Now() + grown;
+    int64_t held = resume.load(std::memory_order_relaxed);
+    while(held < until && !resume.compare_exchange_weak(held, until, std::memory_order_relaxed));
+
+    LOGD("{} Backing Off {}ns for Cause {}\n", TAG, grown, uint32_t(cause));
+
+}
+
+void Scheduler::Relax() noexcept {
+
+    for(auto& current: backoff) {
+
+        int64_t value = current.load(std::memory_order_relaxed);
+        while(value && !current.compare_exchange_weak(value, value / 2 < config.minbackoff.count() ? 0 : value / 2, std::memory_order_relaxed));
+
+    }
+}
+
+void Scheduler::WaitTurn() noexcept {
+
+    const int64_t until = resume.load(std::memory_order_relaxed);
+    if(Now() >= until)
+        return;
+
+    stalls.fetch_add(1, std::memory_order_relaxed);
+    std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(until)));
+
+}
+
+bool Scheduler::IsThrottled() const noexcept {
+
+    return Now() < resume.load(std::memory_order_relaxed);
+
+}
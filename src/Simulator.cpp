@@ -0,0 +1,535 @@
+/**
+ * \file Simulator.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Simulated USX Box
+ * \version 0.1
+ * \date 2022-05-04
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Simulator.hpp"
+
+#include <charconv>
+#include <thread>
+#include <algorithm>
+
+#include <fmt/format.h>
+#include <fmt/compile.h>
+
+using SoundCath::Simulator;
+using SoundCath::DriverError;
+
+namespace {
+
+constexpr uint8_t ASIC_UNKNOWN_CMD = 1 << 0;    ///< ASICError::UNKNOWN_CMD, the Simulator Doesn't Pull in the ASIC Header
+constexpr uint8_t ASIC_VALID_ERROR = 1 << 1;    ///< ASICError::VALID_ERROR
+constexpr uint32_t FPGA_OVERFULL = 1 << 16;     ///< FPGAError::OVERFULL
+constexpr size_t ASIC_ELEMENTS = 1024;          ///< Elements Behind One ASIC
+
+/**
+ * \brief Splits Off Everything Up to the Separator, Leaves the Rest in the Input
+ *
+ * \param[in,out] args: The String to Split, Gets What is After the Separator
+ * \param[in] separator: What to Split on
+ * \return std::string_view: What Was Before the Separator
+ */
+std::string_view NextField(std::string_view& args, const char separator) noexcept {
+
+    const size_t pos = args.find(separator);
+    const std::string_view field = args.substr(0, pos);
+    args = pos == std::string_view::npos ? std::string_view() : args.substr(pos + 1);
+    return field;
+
+}
+
+/**
+ * \brief Compares Two Command Names Ignoring Case, the DLL Accepts Both FireASIC and FireAsic
+ */
+bool SameName(const std::string_view a, const std::string_view b) noexcept {
+
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const char x, const char y) {
+        return (x | 0x20) == (y | 0x20);
+    });
+
+}
+
+}
+
+const std::array<std::pair<std::string_view, Simulator::Handler>, 33> Simulator::handlers {{
+
+    { "DriverVersion", &Simulator::DriverVersion },
+    { "InitializeDriver", &Simulator::Ok },
+    { "InitializeAsic", &Simulator::InitializeAsic },
+    { "DriverClose", &Simulator::Ok },
+    { "FPGAVersion", &Simulator::FPGAVersion },
+    { "FPGADescription", &Simulator::FPGADescription },
+    { "GetAsicError", &Simulator::GetAsicError },
+    { "GetBandgap", &Simulator::GetBandgap },
+    { "GetTemperature", &Simulator::GetTemperature },
+    { "FireSingleElement", &Simulator::FireSingle },
+    { "ReceiveSingleElement", &Simulator::FireSingle },
+    { "EchoSingleElement", &Simulator::FireSingle },
+    { "FireGroup", &Simulator::FireGroup },
+    { "FireAsic", &Simulator::FireAsic },
+    { "FireGroupReceive", &Simulator::FireGroupReceive },
+    { "FireGroupReceiveDyn", &Simulator::FireGroupReceive },
+    { "FireAsicReceive", &Simulator::FireAsicReceive },
+    { "FireAsicReceiveDyn", &Simulator::FireAsicReceive },
+    { "ReadTxDelays", &Simulator::ReadTxDelays },
+    { "ReadRxDelays", &Simulator::ReadRxDelays },
+    { "SetParam", &Simulator::SetParam },
+    { "GetParam", &Simulator::GetParam },
+    { "AsicConfigure", &Simulator::Ok },
+    { "BmodeSendASICSettings", &Simulator::Ok },
+    { "BmodeQueueASICCompCoeff", &Simulator::QueueCoeffs },
+    { "BmodeQueueASICDelays", &Simulator::QueueDelays },
+    { "BmodeQueueRepeat", &Simulator::QueueRepeat },
+    { "BmodeQueueUpload", &Simulator::QueueUpload },
+    { "BmodeGetQueueEntries", &Simulator::QueueEntries },
+    { "BmodeClearEntries", &Simulator::QueueClear },
+    { "BmodeTriggerEntry", &Simulator::TriggerEntry },
+    { "BmodeFreeze", &Simulator::Ok },
+    { "SerialNumber", &Simulator::Ok }
+
+}};
+
+Simulator::Simulator(const Config& config): config(config), rng(config.seed),
+    txdelays(ASIC_ELEMENTS * config.numasics, 15), // what the ASIC uses when all of the coefficients are zero
+    rxdelays(ASIC_ELEMENTS * config.numasics, 14),
+    rxphases(ASIC_ELEMENTS * config.numasics, 0) {
+
+}
+
+uint32_t Simulator::Call(const char* command, char* output) {
+
+    const std::string_view line(command);
+    std::string_view args = line;
+    current = NextField(args, ':');
+    commandcount++;
+
+    if(config.latency.count() || config.bytespersec > 0.0) {
+
+        auto wait = config.latency;
+        if(config.bytespersec > 0.0)
+            wait += std::chrono::nanoseconds(int64_t(line.size() / config.bytespersec * 1e9));
+
+        std::this_thread::sleep_for(wait);
+
+    }
+
+    const auto handler = std::find_if(handlers.begin(), handlers.end(), [this](const auto& entry) {
+        return SameName(entry.first, current);
+    });
+
+    if(handler == handlers.end()) {
+
+        asicstatus |= ASIC_UNKNOWN_CMD;
+        Respond(output, current, " Unknown Command");
+        return DriverError::PARAM;
+
+    }
+
+    if(ShouldFail(line)) {
+
+        Respond(output, current, " ERROR");
+        return config.drivererror;
+
+    }
+
+    return (this->*(handler->second))(args, output);
+
+}
+
+bool Simulator::ShouldFail(const std::string_view command) {
+
+    if(forcederrors) {
+
+        forcederrors--;
+
+    }
+    else {
+
+        if(config.errorrate <= 0.0)
+            return false;
+
+        if(config.errorprefix.empty()) {
+            if(SameName(current, "GetAsicError")) // the status has to stay readable or nobody can see what failed
+                return false;
+        }
+        else if(command.substr(0, config.errorprefix.size()) != config.errorprefix)
+            return false;
+
+        if(!std::bernoulli_distribution(config.errorrate)(rng))
+            return false;
+
+    }
+
+    asicstatus |= config.asicerror;
+    fpgastatus |= config.fpgaerror;
+    return true;
+
+}
+
+uint32_t Simulator::Respond(char* output, const std::string_view name, const std::string_view result) {
+
+    auto end = fmt::format_to_n(output, UINT16_MAX - 1, FMT_COMPILE("{}:RESULT:{}"), name, result).out;
+    *end = '\0';
+    return DriverError::OK;
+
+}
+
+size_t Simulator::ParseInts(std::string_view field, int32_t* values, const size_t max) noexcept {
+
+    size_t count = 0;
+    while(!field.empty()) {
+
+        std::string_view item = NextField(field, ',');
+        while(!item.empty() && (item.front() == ' ' || item.front() == '+'))
+            item.remove_prefix(1);
+
+        if(count == max)
+            return SIZE_MAX;
+
+        const auto [ptr, ec] = std::from_chars(item.data(), item.data() + item.size(), values[count]);
+        if(ec != std::errc() || (ptr != item.data() + item.size() && *ptr != ' '))
+            return SIZE_MAX;
+
+        count++;
+
+    }
+
+    return count;
+
+}
+
+// ---------------------------- Command Handlers ------------------------------ //
+
+uint32_t Simulator::Ok(std::string_view args, char* output) {
+
+    (void)args;
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::DriverVersion(std::string_view args, char* output) {
+
+    (void)args;
+    return Respond(output, current, " SVN Build 2465 (Simulated)");
+
+}
+
+uint32_t Simulator::InitializeAsic(std::string_view args, char* output) {
+
+    int32_t speed = 0;
+    if(ParseInts(args, &speed, 1) != 1 || (speed != 0 && speed != 25 && speed != 100)) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " Invalid Clock Speed");
+        return DriverError::PARAM;
+
+    }
+
+    char result[64];
+    *fmt::format_to_n(result, sizeof(result) - 1, FMT_COMPILE("{} Asics found, Version 2, ClkSpeed {} MHz, SerialNumber [0] 100"), config.numasics, speed).out = '\0';
+    return Respond(output, current, result);
+
+}
+
+uint32_t Simulator::FPGAVersion(std::string_view args, char* output) {
+
+    (void)args;
+    return Respond(output, current, "HW 2, FPGA SVN 2465");
+
+}
+
+uint32_t Simulator::FPGADescription(std::string_view args, char* output) {
+
+    (void)args;
+    return Respond(output, current, "Simulator:SIM0001");
+
+}
+
+uint32_t Simulator::GetAsicError(std::string_view args, char* output) {
+
+    (void)args;
+    char result[64];
+    *fmt::format_to_n(result, sizeof(result) - 1, FMT_COMPILE("ASIC Error Status: {:02X}, FPGA Error Status: {:08X}"), asicstatus, fpgastatus).out = '\0';
+    asicstatus = 0; // read to clear, like the box
+    fpgastatus = 0;
+    return Respond(output, current, result);
+
+}
+
+uint32_t Simulator::GetBandgap(std::string_view args, char* output) {
+
+    (void)args;
+    return Respond(output, current, " Bandgap Voltage: 1.12V");
+
+}
+
+uint32_t Simulator::GetTemperature(std::string_view args, char* output) {
+
+    (void)args;
+    return Respond(output, current, " Temperature Voltage: 0.70V");
+
+}
+
+uint32_t Simulator::FireSingle(std::string_view args, char* output) {
+
+    int32_t values[3];
+    const size_t count = ParseInts(args, values, 3);
+    if(count < 2 || count == SIZE_MAX || !ValidGroup(values[0]) || values[1] < 0 || values[1] >= 16) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::FireGroup(std::string_view args, char* output) {
+
+    int32_t group = 0;
+    if(ParseInts(NextField(args, ':'), &group, 1) != 1 || !ValidGroup(group) || ParseInts(args, scratch.data(), 16) != 16) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    std::copy_n(scratch.begin(), 16, txdelays.begin() + group * 16);
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::FireAsic(std::string_view args, char* output) {
+
+    if(ParseInts(args, scratch.data(), scratch.size()) != scratch.size()) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    std::copy(scratch.begin(), scratch.end(), txdelays.begin()); // ASIC 0, the one the readback reports
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::FireGroupReceive(std::string_view args, char* output) {
+
+    // transmitting group, receiving group and output group, then 16 tx delays, then 16 rx delays or 16 rx delays and 16 phases
+    int32_t groups[3];
+    int32_t rx[32];
+    size_t count = 0;
+
+    if(ParseInts(NextField(args, ':'), groups, 3) != 3 || !ValidGroup(groups[0]) || !ValidGroup(groups[1]) || !ValidGroup(groups[2]) ||
+        ParseInts(NextField(args, ':'), scratch.data(), 16) != 16 || ((count = ParseInts(args, rx, 32)) != 16 && count != 32)) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    std::copy_n(scratch.begin(), 16, txdelays.begin() + groups[0] * 16);
+    std::copy_n(rx, 16, rxdelays.begin() + groups[1] * 16);
+    if(count == 32)
+        std::copy_n(rx + 16, 16, rxphases.begin() + groups[1] * 16);
+
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::FireAsicReceive(std::string_view args, char* output) {
+
+    // receiving group and output group, then the 1024 tx delays, then the rx delays and phases of the receiving group
+    int32_t groups[2];
+    int32_t rx[32];
+    size_t count = 0;
+
+    if(ParseInts(NextField(args, ':'), groups, 2) != 2 || !ValidGroup(groups[0]) || !ValidGroup(groups[1]) ||
+        ParseInts(NextField(args, ':'), scratch.data(), scratch.size()) != scratch.size() ||
+        ((count = ParseInts(args, rx, 32)) != 16 && count != 32)) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    std::copy(scratch.begin(), scratch.end(), txdelays.begin());
+    std::copy_n(rx, 16, rxdelays.begin() + groups[0] * 16);
+    if(count == 32)
+        std::copy_n(rx + 16, 16, rxphases.begin() + groups[0] * 16);
+
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::ReadTxDelays(std::string_view args, char* output) {
+
+    (void)args;
+    auto end = fmt::format_to(output, FMT_COMPILE("{}:RESULT[ASIC 0]: "), current);
+    for(size_t i = 0; i < scratch.size(); i++) // ASIC 0
+        end = fmt::format_to(end, FMT_COMPILE("{}{}"), txdelays[i], i + 1 < scratch.size() ? "," : "");
+
+    *end = '\0';
+    return DriverError::OK;
+
+}
+
+uint32_t Simulator::ReadRxDelays(std::string_view args, char* output) {
+
+    (void)args;
+    auto end = fmt::format_to(output, FMT_COMPILE("{}:RESULT[ASIC 0]:"), current);
+    for(size_t i = 0; i < scratch.size(); i++) // ASIC 0
+        end = fmt::format_to(end, FMT_COMPILE(" {}/{}"), rxdelays[i], rxphases[i]);
+
+    *end = '\0';
+    return DriverError::OK;
+
+}
+
+uint32_t Simulator::SetParam(std::string_view args, char* output) {
+
+    const std::string_view name = NextField(args, ':');
+    if(name.empty() || name.find(',') == std::string_view::npos || args.empty()) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    const auto param = userparams.find(name);
+    if(param == userparams.end())
+        userparams.emplace(name, args);
+    else param->second = args;
+
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::GetParam(std::string_view args, char* output) {
+
+    const auto param = userparams.find(args);
+    if(param == userparams.end()) {
+
+        Respond(output, current, " Unknown Parameter");
+        return DriverError::PARAM;
+
+    }
+
+    return Respond(output, current, param->second);
+
+}
+
+uint32_t Simulator::QueueCoeffs(std::string_view args, char* output) {
+
+    if(ParseInts(NextField(args, ':'), scratch.data(), 8) != 8 || ParseInts(args, scratch.data() + 8, 10) != 10) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    queuedbeams++;
+    havebeam = true;
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::QueueDelays(std::string_view args, char* output) {
+
+    if(ParseInts(NextField(args, ':'), scratch.data(), scratch.size()) != scratch.size() ||
+        ParseInts(NextField(args, ':'), scratch.data(), scratch.size()) != scratch.size() ||
+        (!args.empty() && ParseInts(args, scratch.data(), scratch.size()) != scratch.size())) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    queuedbeams++;
+    havebeam = true;
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::QueueRepeat(std::string_view args, char* output) {
+
+    (void)args;
+    if(!havebeam) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " Nothing to Repeat");
+        return DriverError::STATUS;
+
+    }
+
+    queuedbeams++;
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::QueueUpload(std::string_view args, char* output) {
+
+    (void)args;
+    if(queueentries + queuedbeams > config.queuecapacity) {
+
+        fpgastatus |= FPGA_OVERFULL;
+        queuedbeams = 0;
+        Respond(output, current, " ERROR");
+        return DriverError::FPGAERROR;
+
+    }
+
+    queueentries += queuedbeams;
+    queuedbeams = 0;
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::QueueEntries(std::string_view args, char* output) {
+
+    (void)args;
+    char result[32];
+    *fmt::format_to_n(result, sizeof(result) - 1, FMT_COMPILE("{} Entries"), queueentries).out = '\0';
+    return Respond(output, current, result);
+
+}
+
+uint32_t Simulator::QueueClear(std::string_view args, char* output) {
+
+    (void)args;
+    queueentries = 0;
+    queuedbeams = 0;
+    havebeam = false;
+    return Respond(output, current, " OK");
+
+}
+
+uint32_t Simulator::TriggerEntry(std::string_view args, char* output) {
+
+    int32_t entry = 0;
+    if(ParseInts(args, &entry, 1) != 1 || entry < 0 || uint32_t(entry) >= queueentries) {
+
+        asicstatus |= ASIC_VALID_ERROR;
+        Respond(output, current, " ERROR");
+        return DriverError::PARAM;
+
+    }
+
+    return Respond(output, current, " OK");
+
+}
\ No newline at end of file
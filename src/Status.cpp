@@ -0,0 +1,86 @@
+/**
+ * \file Status.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Status and Voltage Parsers
+ * \version 0.1
+ * \date 2022-05-19
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Status.hpp"
+#include "Exception.hpp"
+#include "Logging.hpp"
+
+#include <charconv>
+
+using SoundCath::DeviceStatus;
+using SoundCath::ASICError;
+using SoundCath::FPGAError;
+using SoundCath::DriverException;
+using SoundCath::DriverError;
+
+static const char* const TAG = "Status::";
+
+std::optional<DeviceStatus> DeviceStatus::Parse(const std::string_view response) noexcept {
+
+    // "GetAsicError:RESULT:ASIC Error Status: hh, FPGA Error Status: hhhhhhhh"
+    constexpr std::string_view asicheader = "ASIC Error Status: ";
+    constexpr std::string_view fpgaheader = "FPGA Error Status: ";
+
+    const size_t asic = response.find(asicheader);
+    if(asic == std::string_view::npos)
+        return std::nullopt;
+
+    const size_t fpga = response.find(fpgaheader, asic + asicheader.size());
+    if(fpga == std::string_view::npos)
+        return std::nullopt;
+
+    const char* const end = response.data() + response.size();
+
+    uint8_t asicerror;
+    uint32_t fpgaerror;
+    if(std::from_chars(response.data() + asic + asicheader.size(), end, asicerror, 16).ec != std::errc() ||
+       std::from_chars(response.data() + fpga + fpgaheader.size(), end, fpgaerror, 16).ec != std::errc())
+        return std::nullopt;
+
+    return DeviceStatus{ ASICError::Code(asicerror), FPGAError::Code(fpgaerror) };
+
+}
+
+DeviceStatus DeviceStatus::Query(const Driver& driver) {
+
+    const std::string response = driver.Query("GetAsicError");
+    const auto status = Parse(response);
+
+    if(!status) {
+
+        LOGE("{} Couldn't Find the Status in {}\n", TAG, response);
+        throw DriverException(DriverError::USB_RECEIVE);
+
+    }
+
+    LOGD("{} ASIC Status: {:02X}, FPGA Status: {:08X}\n", TAG, uint8_t(status->asic), uint32_t(status->fpga));
+    return *status;
+
+}
+
+std::optional<double> SoundCath::ParseVolts(std::string_view response) noexcept {
+
+    const size_t colon = response.rfind(':');
+    if(colon == std::string_view::npos)
+        return std::nullopt;
+
+    response.remove_prefix(colon + 1);
+    while(!response.empty() && response.front() == ' ')
+        response.remove_prefix(1);
+
+    double volts;
+    const auto [end, error] = std::from_chars(response.data(), response.data() + response.size(), volts);
+    if(error != std::errc() || end == response.data() + response.size() || *end != 'V')
+        return std::nullopt;
+
+    return volts;
+
+}
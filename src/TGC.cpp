@@ -0,0 +1,97 @@
+/**
+ * \file TGC.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Time Gain Compensation Stage
+ * \version 0.1
+ * \date 2022-05-28
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "TGC.hpp"
+#include "Logging.hpp"
+#include "SIMD.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+
+using SoundCath::TGC;
+using SoundCath::USParams;
+using SoundCath::BeamformedFrame;
+
+static const char* const TAG = "TGC::";
+
+TGC::TGC(const USParams& params, const double samplerate_hz, const float max_db) noexcept: max_db(max_db) {
+
+    wanted.samplerate_hz = samplerate_hz;
+    SetParams(params);
+
+}
+
+void TGC::SetParams(const USParams& params) noexcept {
+
+    wanted.attenuation = params.attenuation;
+    wanted.freq_cent_mhz = params.freq_cent_mhz;
+    wanted.soundspeed = params.trparams.soundspeed;
+
+}
+
+const std::vector<float>& TGC::GetGains(const size_t samples) {
+
+    wanted.samples = samples;
+    if(wanted == built)
+        return gains;
+
+    // there and back, in dB per mm, then in nepers of amplitude since the gain is exp(k * z)
+    const double db_per_mm = 2.0 * wanted.attenuation * wanted.freq_cent_mhz / 10.0;
+    const double k = db_per_mm / 20.0 * std::numbers::ln10;
+    const double step = wanted.soundspeed * 1e3 / (2.0 * wanted.samplerate_hz); // mm of depth per sample, there and back
+    const double max_gain = std::pow(10.0, max_db / 20.0);
+
+    gains.resize(samples);
+    for(size_t n = 0; n < samples; n++)
+        gains[n] = float(std::min(std::exp(k * step * double(n)), max_gain));
+
+    built = wanted;
+    builds++;
+
+    LOGD("{} Built the Gains of {} Samples, {:.1f} dB at the Deepest\n", TAG, samples, samples ? 20.0 * std::log10(gains.back()) : 0.0);
+    return gains;
+
+}
+
+void TGC::Multiply(float* line, const float* gains, const size_t samples) noexcept {
+
+    size_t n = 0;
+
+    for(; n + SIMD::WIDTH <= samples; n += SIMD::WIDTH)
+        SIMD::Store(line + n, SIMD::Mul(SIMD::Load(line + n), SIMD::Load(gains + n)));
+
+    for(; n < samples; n++) // the tail, past the last whole vector
+        line[n] *= gains[n];
+
+}
+
+void TGC::Apply(float* line, const size_t samples) {
+
+    Multiply(line, GetGains(samples).data(), samples);
+
+}
+
+void TGC::Apply(float* lines, const size_t count, const size_t samples, ThreadPool& pool) {
+
+    // built here, before the threads only read it
+    const float* const table = GetGains(samples).data();
+    pool.ParallelFor(count, [&](const size_t line) {
+        Multiply(lines + line * samples, table, samples);
+    });
+
+}
+
+void TGC::Apply(BeamformedFrame& frame, ThreadPool& pool) {
+
+    Apply(frame.data.data(), frame.lines, frame.samples, pool);
+
+}
@@ -0,0 +1,174 @@
+/**
+ * \file Telemetry.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Telemetry Poller
+ * \version 0.1
+ * \date 2022-05-18
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Telemetry.hpp"
+#include "Exception.hpp"
+#include "Logging.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+using SoundCath::Telemetry;
+using SoundCath::ASICError;
+using SoundCath::FPGAError;
+using SoundCath::DeviceStatus;
+using SoundCath::ParseVolts;
+
+static const char* const TAG = "Telemetry::";
+
+Telemetry::Telemetry(Driver& driver, const std::chrono::milliseconds period):
+    driver(driver), period(std::max(period, std::chrono::milliseconds(1))), poller(&Telemetry::Run, this) {
+
+}
+
+Telemetry::~Telemetry() {
+
+    {
+        std::scoped_lock<std::mutex> guard(lock);
+        stop = true;
+    }
+
+    wake.notify_one();
+    poller.join();
+
+}
+
+void Telemetry::Run() {
+
+    std::unique_lock<std::mutex> guard(lock);
+    while(!stop) {
+
+        guard.unlock();
+        const bool done = Poll();
+        guard.lock();
+
+        // a poll put off by a busy driver is tried again well before the next one is due
+        wake.wait_for(guard, done ? period : std::max(period / 8, std::chrono::milliseconds(1)), [this] { return stop; });
+
+    }
+}
+
+bool Telemetry::Poll() {
+
+    if(read == READ_ALL) // the last period finished, start a new one
+        read = 0;
+
+    // each reading is one round trip, so a busy driver only delays the ones that haven't gone out yet
+    const auto reading = [this](const uint8_t flag, const char* const command, const auto& parse) {
+
+        if(read & flag)
+            return true;
+
+        try {
+
+            const auto response = driver.QueryIfIdle(command);
+            if(!response) {
+
+                deferred.fetch_add(1, std::memory_order_relaxed);
+                return false;
+
+            }
+
+            if(!parse(*response))
+                LOGW("{} Couldn't Parse the Response to {}: {}\n", TAG, command, *response);
+
+        }
+        catch(const std::exception& e) { // keep the last reading, the next period tries again
+
+            LOGW("{} {} Failed: {}\n", TAG, command, e.what());
+
+        }
+
+        read |= flag;
+        return true;
+
+    };
+
+    const bool done =
+        reading(READ_STATUS, "GetAsicError", [this](std::string_view response) {
+            const auto status = DeviceStatus::Parse(response);
+            if(status) {
+                latest.asicerror = status->asic;
+                latest.fpgaerror = status->fpga;
+            }
+            return status.has_value();
+        }) &&
+        reading(READ_BANDGAP, "GetBandgap", [this](std::string_view response) {
+            const auto volts = ParseVolts(response);
+            latest.bandgap_v = volts.value_or(latest.bandgap_v);
+            return volts.has_value();
+        }) &&
+        reading(READ_TEMPERATURE, "GetTemperature", [this](std::string_view response) {
+            const auto volts = ParseVolts(response);
+            latest.temperature_v = volts.value_or(latest.temperature_v);
+            return volts.has_value();
+        });
+
+    if(!done)
+        return false;
+
+    latest.valid = true;
+    Publish(latest);
+    polls.fetch_add(1, std::memory_order_relaxed);
+    return true;
+
+}
+
+void Telemetry::Publish(const Health& readings) noexcept {
+
+    const Packed words = Pack(readings);
+    const uint32_t count = sequence.load(std::memory_order_relaxed);
+
+    sequence.store(count + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    health[0].store(words[0], std::memory_order_relaxed);
+    health[1].store(words[1], std::memory_order_relaxed);
+    sequence.store(count + 2, std::memory_order_release);
+
+}
+
+Telemetry::Health Telemetry::GetHealth() const noexcept {
+
+    // a poll finishes in microseconds and only once a period, so retrying on a torn read is almost never needed
+    while(true) {
+
+        const uint32_t before = sequence.load(std::memory_order_acquire);
+        const Packed words = { health[0].load(std::memory_order_relaxed), health[1].load(std::memory_order_relaxed) };
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if(!(before & 1) && sequence.load(std::memory_order_relaxed) == before)
+            return Unpack(words);
+
+    }
+}
+
+Telemetry::Packed Telemetry::Pack(const Health& readings) noexcept {
+
+    const auto millivolts = [](const double volts) { return uint64_t(std::clamp<int64_t>(std::llround(volts * 1e3), 0, int64_t(UINT32_MAX))); };
+
+    return {
+        uint64_t(uint32_t(readings.fpgaerror)) | (uint64_t(readings.asicerror) << 32) | (uint64_t(readings.valid) << 40),
+        millivolts(readings.bandgap_v) | (millivolts(readings.temperature_v) << 32)
+    };
+
+}
+
+Telemetry::Health Telemetry::Unpack(const Packed& words) noexcept {
+
+    Health readings;
+    readings.fpgaerror = FPGAError::Code(words[0] & 0xFFFFFFFF);
+    readings.asicerror = ASICError::Code((words[0] >> 32) & 0xFF);
+    readings.valid = (words[0] >> 40) & 1;
+    readings.bandgap_v = (words[1] & 0xFFFFFFFF) * 1e-3;
+    readings.temperature_v = (words[1] >> 32) * 1e-3;
+    return readings;
+
+}
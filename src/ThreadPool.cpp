@@ -0,0 +1,107 @@
+/**
+ * \file ThreadPool.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the Thread Pool
+ * \version 0.1
+ * \date 2022-05-10
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using SoundCath::ThreadPool;
+
+ThreadPool::ThreadPool(const size_t threads) {
+
+    const size_t count = threads ? threads : std::max(std::thread::hardware_concurrency(), 1u);
+    workers.reserve(count - 1); // the caller is the last one
+    for(size_t i = 1; i < count; i++)
+        workers.emplace_back(&ThreadPool::Worker, this);
+
+}
+
+ThreadPool::~ThreadPool() {
+
+    {
+        std::scoped_lock<std::mutex> guard(lock);
+        stopping = true;
+    }
+
+    wake.notify_all();
+    for(auto& worker: workers)
+        worker.join();
+
+}
+
+void ThreadPool::ParallelFor(const size_t count, const std::function<void(size_t)>& body) {
+
+    if(!count)
+        return;
+
+    std::scoped_lock<std::mutex> serial(calllock);
+
+    {
+        std::scoped_lock<std::mutex> guard(lock);
+        job = &body;
+        total = count;
+        next = 0;
+        running = workers.size();
+        error = nullptr;
+        generation++;
+    }
+
+    wake.notify_all();
+    Run();
+
+    std::unique_lock<std::mutex> guard(lock);
+    done.wait(guard, [this] { return running == 0; });
+    job = nullptr;
+
+    if(error)
+        std::rethrow_exception(std::exchange(error, nullptr));
+
+}
+
+void ThreadPool::Run() noexcept {
+
+    for(size_t i = next++; i < total; i = next++) {
+
+        try {
+            (*job)(i);
+        }
+        catch(...) {
+            std::scoped_lock<std::mutex> guard(lock);
+            if(!error)
+                error = std::current_exception();
+            next = total; // nobody needs the rest anymore
+        }
+
+    }
+}
+
+void ThreadPool::Worker() {
+
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> guard(lock);
+
+    while(true) {
+
+        wake.wait(guard, [&] { return stopping || generation != seen; });
+        if(stopping)
+            return;
+
+        seen = generation;
+        guard.unlock();
+        Run();
+        guard.lock();
+
+        if(--running == 0)
+            done.notify_one();
+
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * \file Transport.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Contains the Implementation of the DLL Transport and the Default Transport Selection
+ * \version 0.1
+ * \date 2022-05-04
+ *
+ * \copyright Copyright (c) 2022
+ *
+ */
+
+#include "Transport.hpp"
+#include "Simulator.hpp"
+
+#include "Logging.hpp"
+
+using SoundCath::Transport;
+
+static const char* const TAG = "Transport::";
+
+#if defined(_WIN32) || defined(_WIN64)
+
+using SoundCath::DLLTransport;
+
+DLLTransport::DLLTransport(const char* const path) {
+
+	this->dll = LoadLibrary(path);
+	if (!this->dll) {
+        LOGE("{} DLL Not Found or Not Accessable\n", TAG);
+        exit(1);
+    }
+
+	asic_call_parse = (f_dllfunction)GetProcAddress(this->dll, "asic_call_parse");
+	if (!this->asic_call_parse){
+        LOGE("{} Could Not Access or Find the ASIC Call Function in the DLL\n", TAG);
+        exit(1);
+    }
+}
+
+DLLTransport::~DLLTransport() {
+
+    static char closebuffer[UINT16_MAX];
+    asic_call_parse((char*)"DriverClose", closebuffer);
+	FreeLibrary(this->dll);
+
+}
+
+uint32_t DLLTransport::Call(const char* command, char* output) {
+
+    return asic_call_parse((char*)command, output);
+
+}
+
+std::unique_ptr<Transport> SoundCath::MakeDefaultTransport() {
+
+    return std::make_unique<DLLTransport>();
+
+}
+
+#else
+
+std::unique_ptr<Transport> SoundCath::MakeDefaultTransport() {
+
+    LOGI("{} No Oldelft DLL on this Platform, Using the Simulated USX Box\n", TAG);
+    return std::make_unique<Simulator>();
+
+}
+
+#endif
\ No newline at end of file
@@ -10,98 +10,164 @@
  */
 
 #include "Ultrasound.hpp"
+#include "Config.hpp"
+#include "Logging.hpp"
+
+#include <vector>
+#include <future>
+#include <utility>
+#include <exception>
 
 #include "fmt/format.h"
 #include "fmt/compile.h"
 
-using SoundCath::UltraSound;
+using SoundCath::RuntimeUltraSound;
+using SoundCath::RuntimeScanData;
 using SoundCath::USParams;
+using SoundCath::RegisterShadow;
+using SoundCath::Transport;
+
+static const char* TAG = "UltraSound::";
+
+RuntimeUltraSound::RuntimeUltraSound(const USParams& usparams): RuntimeUltraSound(usparams, SoundCath::MakeDefaultTransport()) {}
 
-template<USParams params>
-UltraSound<params>::UltraSound(): driver(), asic(driver), fpga(driver) {
+RuntimeUltraSound::RuntimeUltraSound(const USParams& usparams, std::unique_ptr<Transport> transport):
+    driver(std::move(transport)), asic(driver, usparams.asicparams.speed), fpga(driver) {
 
-    SetParams();
+    SetParams(usparams);
 
 }
 
-template<USParams params>
-void UltraSound<params>::SetParams() const {
-    
+RuntimeUltraSound::RuntimeUltraSound(const std::string& path): RuntimeUltraSound(SoundCath::LoadParams(path)) {}
+
+void RuntimeUltraSound::LoadParams(const std::string& path) {
+
+    SetParams(SoundCath::LoadParams(path)); // parsed in full before anything is sent
+
+}
+
+void RuntimeUltraSound::SetParams(const USParams& usparams) {
+
+    SoundCath::ValidateParams(usparams);
+
+    trparams = usparams.trparams;
+    conparams = usparams.conparams;
+    wanted = GetRegisters(usparams);
+    Sync();
+
+}
+
+void RuntimeUltraSound::ResendParams() {
+
+    shadow.Clear();
+    Sync();
+
+}
+
+void RuntimeUltraSound::Sync() {
+
+    const auto changes = shadow.Diff(wanted);
+    LOGD("{} Setting {} Changed Parameters\n", TAG, changes.size());
+
+    std::vector<std::future<std::string>> pending;
+    pending.reserve(changes.size());
+    for(const auto& change: changes)
+        pending.push_back(driver.SendAsync(fmt::format(FMT_COMPILE("SetParam:{}:{}"), change.key, change.value)));
+
+    std::exception_ptr error;
+    for(size_t i = 0; i < pending.size(); i++) {
+
+        try {
+            pending[i].get();
+            shadow.Commit(changes[i].key, changes[i].value);
+        }
+        catch(...) {
+            shadow.Invalidate(changes[i].key); // the box might have the old value or neither, send it again next time
+            if(!error)
+                error = std::current_exception();
+        }
+
+    }
+
+    if(error) // the first rejected parameter
+        std::rethrow_exception(error);
+
+}
+
+RegisterShadow RuntimeUltraSound::GetRegisters(const USParams& usparams) {
+
+    RegisterShadow registers;
+
     const char* group = "Config";
-    SetParam(group, "TxClkDivider", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "TxDelayLSBOpt", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "TxDelayLSBRand", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "RxAssignmentOffset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "RxDelayLSBOpt", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "RxDelayLSBRand", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "BeamContRx", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "BeamContTx", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "RandomizeDynUpdate", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "ErrorStopMask", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "LockDuringBeam", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "IBiasCal", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "AsicEnabled", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "TxClkDivider", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "TxDelayLSBOpt", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "TxDelayLSBRand", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "RxAssignmentOffset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "RxDelayLSBOpt", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "RxDelayLSBRand", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "BeamContRx", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "BeamContTx", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "RandomizeDynUpdate", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "ErrorStopMask", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "LockDuringBeam", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "IBiasCal", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "AsicEnabled", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
 
     group = "ConfigCore";
-    SetParam(group,"ISelLNA", params.asicparams.core.ISelLNA);
-    SetParam(group, "ISelOdrv", params.asicparams.core.ISelOdrv);
-    SetParam(group, "ISelResCntl", params.asicparams.core.ISelResCtrl);
-    SetParam(group, "ISelDcGND", params.asicparams.core.ISelDcGND);
-    SetParam(group, "ISelPpHVP", params.asicparams.core.ISelLNA);
-    SetParam(group, "ResCal", params.asicparams.core.ResCal);
-    //SetParam(group, "ResCntlOverwrite", params.asicparams.core.ISelLNA));
-    SetParam(group, "AnalogResetNoRx", params.asicparams.core.AnalogResetNoRx);
-    SetParam(group, "AnalogResetAuto", params.asicparams.core.AnalogResetAuto);
-    SetParam(group, "RxAlwaysEn", params.asicparams.core.RxAlwaysEn);
-    //SetParam(group, "TxPrechargeRandomIsrc", params.asicparams.core.ISelLNA));
-    SetParam(group, "LNAAutoPowerDown", params.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "ISelLNA", usparams.asicparams.core.ISelLNA);
+    registers.Set(group, "ISelOdrv", usparams.asicparams.core.ISelOdrv);
+    registers.Set(group, "ISelResCntl", usparams.asicparams.core.ISelResCtrl);
+    registers.Set(group, "ISelDcGND", usparams.asicparams.core.ISelDcGND);
+    registers.Set(group, "ISelPpHVP", usparams.asicparams.core.ISelLNA);
+    registers.Set(group, "ResCal", usparams.asicparams.core.ResCal);
+    //registers.Set(group, "ResCntlOverwrite", usparams.asicparams.core.ISelLNA));
+    registers.Set(group, "AnalogResetNoRx", usparams.asicparams.core.AnalogResetNoRx);
+    registers.Set(group, "AnalogResetAuto", usparams.asicparams.core.AnalogResetAuto);
+    registers.Set(group, "RxAlwaysEn", usparams.asicparams.core.RxAlwaysEn);
+    //registers.Set(group, "TxPrechargeRandomIsrc", usparams.asicparams.core.ISelLNA));
+    registers.Set(group, "LNAAutoPowerDown", usparams.asicparams.core.LNAAutoPowerDown);
 
     group = "XmitWF";
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
     
     group = "BeamTiming";
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
     
     group = "BModeSendBeam";
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "UseAnalogReset", params.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "UseAnalogReset", usparams.asicparams.core.LNAAutoPowerDown);
     
 
     group = "ConfigDRV";
-    SetParam(group, "BiasSel", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "FFen", params.asicparams.core.LNAAutoPowerDown);
-    SetParam(group, "Enable", params.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "BiasSel", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "FFen", usparams.asicparams.core.LNAAutoPowerDown);
+    registers.Set(group, "Enable", usparams.asicparams.core.LNAAutoPowerDown);
 
-}
-
-template<USParams params>
-void UltraSound<params>::SetParam(const char* const group, const char* const param, const auto& value) const {
+    return registers;
 
-    driver.Send(fmt::format(FMT_COMPILE("SetParam:{},{}:{}"), group, param, value));
-
-}
\ No newline at end of file
+}
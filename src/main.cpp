@@ -12,6 +12,8 @@
 
 #include "Renderer.hpp"
 #include "Ultrasound.hpp"
+#include "Preset.hpp"
+#include "PresetScan.hpp"
 #include "GUI.hpp"
 
 #include "fmt/format.h"
@@ -21,7 +23,6 @@
 using SoundCath::RXController;
 
 /// \todo Write the main to use the ultrsound and render it to a gui
-/// \todo Make sure that the compiler can handle all of the constexpr, needs more than 12GB Ram Currently
 /// \todo Implement a command line argument parser and setup options, there are a few libraries that will help
 
 /**
@@ -36,8 +37,8 @@ int main(const int argc, const char* const* const kwargs) {
     (void)argc;
     (void)kwargs;
 
-    constexpr SoundCath::TransducerParams tparams{};
-    constexpr SoundCath::ControllerParams conparams{};
+    constexpr SoundCath::TransducerParams tparams = SoundCath::PRESET.trparams;
+    constexpr SoundCath::ControllerParams conparams = SoundCath::PRESET.conparams;
 
     auto start = std::chrono::high_resolution_clock::now();
 
@@ -67,7 +68,7 @@ int main(const int argc, const char* const* const kwargs) {
         RXController<conparams.rxparams, tparams>::CalculateDelays(6, 30)
     };    
 
-    static constinit auto scandata = SoundCath::Controller<conparams, tparams>::PreCalcScanData();
+    const SoundCath::PresetScanData* const scandata = SoundCath::GetPresetScanData(); // calculated by ScanGen while building
     
     auto stop = std::chrono::high_resolution_clock::now();
 
@@ -77,8 +78,13 @@ int main(const int argc, const char* const* const kwargs) {
     for (auto& delays: delaydata)
         fmt::print("{}\n", delays.delays);
 
-    for (auto& scanrx: scandata.txdelays)
-        fmt::print("{}\n", scanrx);
+    if(!scandata) {
+        fmt::print("The Built in Scan Data is for Other Parameters, Rebuild\n");
+        return 1;
+    }
+
+    for (auto& scantx: scandata->txcoeffs)
+        fmt::print("{}\n", scantx);
 
     fmt::print("Finished In {}", stop - start);
 
@@ -7,4 +7,116 @@
  * 
  * @copyright Copyright (c) 2022
  * 
- */
\ No newline at end of file
+ */
+
+#include "Test.hpp"
+
+#include <sstream>
+
+#include "Status.hpp"
+#include "Exception.hpp"
+
+using SoundCath::ASICTester;
+using SoundCath::ASICParams;
+
+template<ASICParams params>
+ASICTester<params>::ASICTester(): box(nullptr), driver(MakeBox(box)), asic(driver) {}
+
+template<ASICParams params>
+bool ASICTester<params>::TestTxReadback() {
+
+    Delays fired, read;
+    for(size_t i = 0; i < fired.size(); i++)
+        fired[i] = i % 511; // covers the whole 0 - 510 range
+
+    asic.Fire(fired);
+    asic.ReadTXDelays(read);
+    return fired == read;
+
+}
+
+template<ASICParams params>
+bool ASICTester<params>::TestRxReadback() {
+
+    GroupDelays tx{}, rx{}, phases{};
+    for(size_t i = 0; i < rx.size(); i++) {
+        rx[i] = int8_t(i * 2 - 1); // -1 to 29, the rx range is -1 to 31
+        phases[i] = int8_t(i % 8);
+    }
+
+    constexpr Group group = 5;
+    asic.FireGroup(group, tx, rx, phases);
+
+    Delays delays, readphases;
+    asic.ReadRXDelays(delays, readphases);
+    for(size_t i = 0; i < rx.size(); i++)
+        if(delays[group * 16 + i] != rx[i] || readphases[group * 16 + i] != phases[i])
+            return false;
+
+    return true;
+
+}
+
+template<ASICParams params>
+bool ASICTester<params>::TestStreamRoundTrip() {
+
+    Delays written, read;
+    for(size_t i = 0; i < written.size(); i++)
+        written[i] = int32_t(i) - 512;
+
+    std::stringstream stream;
+    stream << written;
+    stream >> read;
+    return stream && written == read;
+
+}
+
+template<ASICParams params>
+bool ASICTester<params>::TestStatus() {
+
+    using SoundCath::DeviceStatus;
+
+    if(!asic.GetStatus().IsOk() || asic.GetError() != 0)
+        return false;
+
+    const auto busy = DeviceStatus::Parse("GetAsicError:RESULT:ASIC Error Status: 08, FPGA Error Status: 80010200");
+    const auto piggybacked = DeviceStatus::Parse("FireAsic:RESULT: OK, ASIC Error Status: 40, FPGA Error Status: 00000001");
+
+    return busy && busy->asic == SoundCath::ASICError::BUSY && busy->fpga == 0x80010200 &&
+        piggybacked && piggybacked->asic == SoundCath::ASICError::LOCKED && piggybacked->fpga == SoundCath::FPGAError::QSPI &&
+        !DeviceStatus::Parse("FireAsic:RESULT: OK") && !DeviceStatus::Parse("ASIC Error Status: zz, FPGA Error Status: 0") &&
+        asic.GetBandGapV() == 1.12;
+
+}
+
+template<ASICParams params>
+bool ASICTester<params>::TestTryFire() {
+
+    Delays delays{};
+
+    try {
+
+        box->InjectErrors(1);
+        const auto busy = asic.TryFire(delays);
+        if(busy || !(busy.GetError() & DriverError::ASICERROR) || asic.GetError() != ASICError::BUSY)
+            return false;
+
+        if(!asic.TryFire(delays) || !asic.TryQueueBeam(delays, delays) || !asic.TryFlushBeamQueue() || !asic.TryTriggerBeam(0))
+            return false;
+
+    }
+    catch(const std::exception&) { // the whole point is that nothing gets thrown
+        return false;
+    }
+
+    box->InjectErrors(1);
+    try {
+        asic.Fire(delays);
+    }
+    catch(const DriverException&) { // the throwing call still throws
+        return asic.TryClearBeamQueue().HasValue();
+    }
+
+    return false;
+
+}
@@ -12,13 +12,72 @@
 #pragma once
 
 #include "ASIC.hpp"
+#include "../Box.hpp"
 
 namespace SoundCath {
 
+/**
+ * \brief Tests the ASIC Against the Simulated USX Box
+ * 
+ * \tparam params: What ASIC Params to Test the ASIC With
+ */
+template<ASICParams params>
 class ASICTester {
 
+public:
 
-};
+    /**
+     * \brief Construct a new ASIC Tester object, the ASIC Runs on a Default Simulator
+     * 
+     */
+    ASICTester();
+
+    /**
+     * \brief Tests that Fired Tx Delays Read Back the Same
+     * \test Fires the Whole ASIC With a Ramp and Reads the Delays Back
+     * \return true: If Every Delay Matches
+     * \return false: If a Delay Doesn't Match or the Readback Fails
+     */
+    bool TestTxReadback();
+
+    /**
+     * \brief Tests that Rx Group Delays Read Back the Same
+     * \test Fires a Group With Rx Delays and Phases and Reads Them Back
+     * \return true: If the Group Matches
+     * \return false: If a Delay or Phase Doesn't Match or the Readback Fails
+     */
+    bool TestRxReadback();
 
+    /**
+     * \brief Tests that Delays Survive a Trip Through the Stream Operators
+     * \test 
+     * \return true: If the Delays Match
+     * \return false: If They Don't or the Stream Failed
+     */
+    bool TestStreamRoundTrip();
+
+    /**
+     * \brief Tests the Status and Band Gap Parsing Against What the Simulator Sends
+     * \test Reads the Status Clean, With a Busy ASIC, and Piggybacked on Another Response, Then Reads the Band Gap
+     * \return true: If Every Value Parses Right
+     * \return false: If a Value is Wrong or a Good Response Didn't Parse
+     */
+    bool TestStatus();
+
+    /**
+     * \brief Tests that the Non-Throwing Fire and Queue Calls Hand Back a Busy ASIC as an Error Mask
+     * \test Fails the Next Command, Checks TryFire Returns the Error Without Throwing, Then Retries it
+     * \return true: If the Error Came Back as a Value and the Retry Went Through
+     * \return false: If Something Threw or the Mask Was Wrong
+     */
+    bool TestTryFire();
+
+private:
+
+    Simulator* box;         ///< The Simulator the Driver Owns, for Injecting Errors
+    Driver driver;          ///< Runs on the Simulator
+    ASIC<params> asic;      ///< The ASIC Under Test
+
+};
 
-}
\ No newline at end of file
+}
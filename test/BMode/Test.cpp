@@ -0,0 +1,131 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-27
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+
+#include <cmath>
+#include <array>
+#include <random>
+#include <numbers>
+#include <algorithm>
+
+using SoundCath::BModeTester;
+using SoundCath::BMode;
+using SoundCath::BeamformedFrame;
+using SoundCath::ODD_SAMPLES;
+using SoundCath::MakeNoise;
+
+/// Sample Rate of the Synthetic Lines, 8 Times the 5 MHz Center Frequency
+static constexpr double SAMPLE_RATE_HZ = 40e6;
+
+/// A Tone at a Frequency, t in Samples
+static float Tone(const double freq_mhz, const double amplitude, const double t) noexcept {
+
+    return float(amplitude * std::cos(2.0 * std::numbers::pi * freq_mhz * 1e6 / SAMPLE_RATE_HZ * t + .3));
+
+}
+
+bool BModeTester::TestEnvelope() {
+
+    const BMode bmode(BMode::Config{});
+    constexpr size_t SAMPLES = 512;
+    constexpr double MIDDLE = 256.0;
+
+    std::vector<float> rf(SAMPLES), envelope(SAMPLES);
+    for(size_t n = 0; n < SAMPLES; n++) {
+
+        const double t = double(n) - MIDDLE;
+        rf[n] = Tone(5.0, std::exp(-t * t / 20000.0), t);
+
+    }
+
+    bmode.Envelope(rf.data(), SAMPLES, envelope.data());
+    for(size_t n = 64; n < SAMPLES - 64; n++) { // away from the ends, where half the filter sees zeros
+
+        const double t = double(n) - MIDDLE;
+        if(std::abs(envelope[n] - std::exp(-t * t / 20000.0)) > .02)
+            return false;
+
+    }
+
+    // 15 MHz is far outside a 5 MHz +-30% passband
+    for(size_t n = 0; n < SAMPLES; n++)
+        rf[n] = Tone(15.0, 1.0, double(n));
+
+    bmode.Envelope(rf.data(), SAMPLES, envelope.data());
+    return *std::max_element(envelope.begin() + 64, envelope.end() - 64) < .01f;
+
+}
+
+bool BModeTester::TestCompression() {
+
+    BMode::Config config;
+    config.dbrange = 50.0f;
+    config.reference = 2.0f;
+    const BMode bmode(config);
+
+    constexpr size_t SAMPLES = 256;
+    std::vector<float> rf(SAMPLES);
+    std::vector<uint8_t> pixels(SAMPLES);
+
+    // amplitude, dB under the reference, expected pixel
+    const std::array<std::array<double, 2>, 4> cases = {{
+        { 2.0, 255.0 },
+        { 2.0 * std::pow(10.0, -25.0 / 20.0), 127.5 },
+        { 2.0 * std::pow(10.0, -50.0 / 20.0), 0.0 },
+        { 8.0, 255.0 }
+    }};
+
+    for(const auto& [amplitude, pixel]: cases) {
+
+        for(size_t n = 0; n < SAMPLES; n++)
+            rf[n] = Tone(5.0, amplitude, double(n));
+
+        bmode.ProcessLine(rf.data(), SAMPLES, pixels.data());
+        if(std::abs(double(pixels[SAMPLES / 2]) - pixel) > 1.0)
+            return false;
+
+    }
+
+    return true;
+
+}
+
+bool BModeTester::TestBlock() {
+
+    const BMode bmode(BMode::Config{});
+
+    std::mt19937 random(11);
+
+    BeamformedFrame frame;
+    frame.lines = 9;
+    frame.samples = ODD_SAMPLES;
+    frame.data = MakeNoise(frame.lines * frame.samples, random);
+
+    ThreadPool pool(3);
+    std::vector<uint8_t> pixels;
+    bmode.Process(frame, pixels, pool);
+
+    if(pixels.size() != frame.lines * frame.samples)
+        return false;
+
+    std::vector<uint8_t> line(frame.samples);
+    for(size_t l = 0; l < frame.lines; l++) {
+
+        bmode.ProcessLine(frame.GetLine(l), frame.samples, line.data());
+        if(!std::equal(line.begin(), line.end(), pixels.begin() + l * frame.samples))
+            return false;
+
+    }
+
+    return true;
+
+}
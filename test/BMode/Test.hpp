@@ -0,0 +1,53 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-27
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "BMode.hpp"
+#include "../Noise.hpp"
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the B-Mode Stage on Synthetic Lines
+     * 
+     */
+    class BModeTester {
+
+    public:
+
+        /**
+         * \brief Tests the Envelope of a Tone Burst
+         * \test Detects the Envelope of a Burst at the Center Frequency Under a Slow Gaussian and a Tone Well Out of the Passband
+         * \return true: If the Envelope Follows the Gaussian and the Out of Band Tone is Mostly Gone
+         * \return false: If the Envelope is Off
+         */
+        bool TestEnvelope();
+
+        /**
+         * \brief Tests the Log Compression
+         * \test Compresses Tones at the Reference, Half the Range Under it, the Whole Range Under it and Above it
+         * \return true: If They Come Out White, Mid Gray, Black and White
+         * \return false: If a Pixel is More Than One Step Off
+         */
+        bool TestCompression();
+
+        /**
+         * \brief Tests a Block of Lines Over a Thread Pool Against One Line at a Time
+         * \test Processes Noise Lines, Not a Whole Number of Vectors Long, as a Beamformed Frame and Line by Line
+         * \return true: If Every Pixel Matches
+         * \return false: If a Pixel Differs
+         */
+        bool TestBlock();
+
+    };
+
+}
@@ -0,0 +1,128 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-08
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+
+using SoundCath::BeamQueueTester;
+using SoundCath::ControllerParams;
+using SoundCath::TransducerParams;
+using SoundCath::ConfigException;
+
+/// A Small Queue so the Frames Have to be Streamed
+static SoundCath::Simulator::Config SmallQueue() {
+
+    SoundCath::Simulator::Config config;
+    config.queuecapacity = 16;
+    return config;
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+BeamQueueTester<params, tparams>::BeamQueueTester(): box(nullptr), driver(MakeBox(box, SmallQueue())), asic(driver), frame(std::make_unique<ScanData<params, tparams>>()) {
+
+    for(size_t i = 0; i < frame->txcoeffs.size(); i++) {
+        frame->txcoeffs[i] = TxCoeffs{ int16_t(i) };
+        frame->rxcoeffs[i] = RxCoeffs{ int16_t(-int(i)) };
+    }
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool BeamQueueTester<params, tparams>::TestStreaming() {
+
+    BeamQueueManager<ASICParams{}, params, tparams> manager(asic, 16);
+    manager.Fire(*frame);
+    manager.Fire(*frame); // has to clear and start over
+
+    return manager.GetOccupancy() == box->GetQueueEntries() && manager.GetOccupancy() <= 16 && manager.GetRepeatCount() == 0;
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool BeamQueueTester<params, tparams>::TestRepeats() {
+
+    auto same = std::make_unique<ScanData<params, tparams>>(*frame);
+    same->txcoeffs.fill(TxCoeffs{ 1, 2, 3 });
+    same->rxcoeffs.fill(RxCoeffs{ 4, 5, 6 });
+
+    BeamQueueManager<ASICParams{}, params, tparams> manager(asic, 16);
+    manager.Fire(*same);
+
+    // a clear drops the beam a repeat copies, so every fill of the 16 entry queue starts with a full beam
+    const size_t fills = (same->txcoeffs.size() + 15) / 16;
+    return manager.GetRepeatCount() == same->txcoeffs.size() - fills && manager.GetOccupancy() == box->GetQueueEntries();
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool BeamQueueTester<params, tparams>::TestResident() {
+
+    constexpr ControllerParams small = [] { ControllerParams p = params; p.x_steps = 2; p.y_steps = 4; return p; }();
+    auto data = std::make_unique<ScanData<small, tparams>>();
+
+    BeamQueueManager<ASICParams{}, small, tparams> manager(asic, 16);
+    manager.Fire(*data, 1);
+
+    uint64_t before = box->GetCommandCount();
+    manager.Fire(*data, 1);
+    const bool triggered = box->GetCommandCount() - before == 8;
+
+    before = box->GetCommandCount();
+    manager.Fire(*data, 2); // same address, but recalculated, so it goes up again
+    return triggered && box->GetCommandCount() - before > 8 && manager.GetOccupancy() == box->GetQueueEntries();
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool BeamQueueTester<params, tparams>::TestBusy() {
+
+    Scheduler::Config config;
+    config.minbackoff = std::chrono::microseconds(1);
+    config.maxbackoff = std::chrono::microseconds(50);
+    Scheduler scheduler(driver, config);
+
+    BeamQueueManager<ASICParams{}, params, tparams> manager(asic, 16, &scheduler);
+
+    box->GetConfig().errorrate = 0.2;
+    box->GetConfig().errorprefix = "Bmode";
+
+    bool fired = true;
+    try {
+        manager.Fire(*frame);
+    }
+    catch(const std::exception&) {
+        fired = false;
+    }
+
+    box->GetConfig().errorrate = 0.0;
+    box->GetConfig().errorprefix.clear();
+
+    return fired && scheduler.GetRetries(Scheduler::ASIC_BUSY) > 0 && scheduler.GetGiveUps() == 0 &&
+        manager.GetOccupancy() == box->GetQueueEntries();
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool BeamQueueTester<params, tparams>::TestCapacity() {
+
+    // a trigger addresses 256 entries, a bigger queue would wrap around and fire the wrong beams
+    for(const uint32_t capacity: { 1u, 257u }) {
+        try {
+            BeamQueueManager<ASICParams{}, params, tparams> manager(asic, capacity);
+            return false;
+        }
+        catch(const ConfigException&) {}
+    }
+
+    BeamQueueManager<ASICParams{}, params, tparams> manager(asic, 256);
+    return manager.GetBankSize() == 128;
+
+}
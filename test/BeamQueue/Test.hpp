@@ -0,0 +1,87 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-08
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "BeamQueue.hpp"
+#include "../Box.hpp"
+
+#include <memory>
+
+namespace SoundCath {
+
+/**
+ * \brief Tests the Beam Queue Manager Against the Simulated USX Box
+ * 
+ * \tparam params: What Controller Params the Frames Use, Keep the Steps Small
+ * \tparam tparams: What Transducer the Frames are For
+ */
+template<ControllerParams params, TransducerParams tparams>
+class BeamQueueTester {
+
+public:
+
+    /**
+     * \brief Construct a new Beam Queue Tester object, the Simulated Queue Holds 16 Entries
+     * 
+     */
+    BeamQueueTester();
+
+    /**
+     * \brief Tests that Every Beam of a Frame Bigger than the Queue Gets Fired Without Overfilling it
+     * \test Fires a Frame and Checks the Local Occupancy Against the Simulator
+     * \return true: If the Frame Fired and the Occupancy Matches
+     * \return false: If a Command Failed or the Count is Off
+     */
+    bool TestStreaming();
+
+    /**
+     * \brief Tests that Consecutive Identical Beams are Sent as Repeats
+     * \test Fires a Frame Where Every Beam is the Same, Through a Queue That has to be Cleared Along the Way
+     * \return true: If Every Beam but the First After Each Clear was a Repeat
+     * \return false: Otherwise
+     */
+    bool TestRepeats();
+
+    /**
+     * \brief Tests that a Frame that Fits in the Queue is Only Uploaded Once
+     * \test Fires a Small Frame Twice With the Same Id and Counts the Commands, Then Again With a New Id
+     * \return true: If the Second Fire Only Sent Triggers and the Third Uploaded the Frame Again
+     * \return false: Otherwise
+     */
+    bool TestResident();
+
+    /**
+     * \brief Tests that Only Queues a Trigger can Address are Accepted
+     * \test Makes Managers With 1, 257 and 256 Entries
+     * \return true: If the First Two Threw and the Last Didn't
+     * \return false: Otherwise
+     */
+    bool TestCapacity();
+
+    /**
+     * \brief Tests that a Frame Streams Through a Busy Box When the Queue Commands go Through a \ref Scheduler
+     * \test Fails Some of the Queue Commands With a Busy ASIC and Checks the Frame Still Lands
+     * \return true: If the Frame Fired, Retries Happened and the Occupancy Matches
+     * \return false: If a Command Failed or the Count is Off
+     */
+    bool TestBusy();
+
+private:
+
+    Simulator* box;                                                 ///< The Simulated Box, Owned by the Driver
+    Driver driver;                                                  ///< Runs on the Simulator
+    ASIC<ASICParams{}> asic;                                        ///< The ASIC the Beams go Through
+    std::unique_ptr<ScanData<params, tparams>> frame;               ///< Frame of Distinct Beams, Too Big for the Stack
+
+};
+
+}
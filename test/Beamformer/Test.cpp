@@ -0,0 +1,259 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-26
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+#include "Exception.hpp"
+
+#include <cmath>
+#include <random>
+#include <numbers>
+#include <algorithm>
+
+using SoundCath::BeamformerTester;
+using SoundCath::Beamformer;
+using SoundCath::RFFrame;
+using SoundCath::BeamformedFrame;
+using SoundCath::DelayTable;
+using SoundCath::ControllerParams;
+using SoundCath::TransducerParams;
+using SoundCath::BeamGeometry;
+using SoundCath::TaylorKernel;
+using SoundCath::QuantDelays;
+using SoundCath::QuantPhases;
+using SoundCath::ThreadPool;
+using SoundCath::ConfigException;
+using SoundCath::ODD_SAMPLES;
+using SoundCath::MakeNoise;
+
+/// Sample Rate of the Synthetic RF, 8 Times the 5 MHz Center Frequency so Linear Interpolation Loses Little
+static constexpr double SAMPLE_RATE_HZ = 40e6;
+
+/// A Small Delay Scan
+static constexpr ControllerParams scan = [] { ControllerParams p{}; p.x_steps = 3; p.y_steps = 2; p.usedelays = true; return p; }();
+
+/// The Same Scan Compressed to Taylor Coefficients
+static constexpr ControllerParams TAYLOR = [] { ControllerParams p = scan; p.usedelays = false; return p; }();
+
+/// A 5 MHz Pulse Under a Gaussian, t in Samples
+static float Pulse(const double t) noexcept {
+
+    return float(std::exp(-t * t / 32.0) * std::cos(2.0 * std::numbers::pi * t / 8.0));
+
+}
+
+/**
+ * \brief Echoes a Point Onto Every Element for Every Beam of a Scan, or Onto the Group Outputs After the ASIC's Fine
+ * Delays, Beamforms the Elements and the Groups With the Scan's Delays and Checks Every Line Adds Up
+ *
+ * \param[in] data: The Scan
+ * \param[in] early: How Many Samples Early the Echo Reaches an Element on a Beam
+ * \param[in] fine: How Many Samples the ASIC Delays an Element by on a Beam
+ * \param[in] pool: Threads to Form the Lines on
+ * \return true: If Every Line Peaks as Tall as its Channels Summed, Less the Quantized Delays and the Interpolation
+ * \return false: If a Line Didn't Line Up
+ */
+template<typename Data, typename Early, typename Fine>
+static bool LinesUp(const Data& data, const Early& early, const Fine& fine, ThreadPool& pool) {
+
+    constexpr double ECHO = 256.0;
+
+    for(const Beamformer::Channels channels: { Beamformer::ELEMENTS, Beamformer::GROUPS }) {
+
+        const bool elements = channels == Beamformer::ELEMENTS;
+        const Beamformer beamformer(TransducerParams{}, SAMPLE_RATE_HZ, scan.rxparams.delay_res_ns, channels, Beamformer::RECTANGULAR);
+        const DelayTable delays = beamformer.GetDelays(data);
+        if(delays.lines != 6 || delays.channels != beamformer.GetChannelCount())
+            return false;
+
+        std::vector<RFFrame> frames(delays.lines);
+        for(size_t beam = 0; beam < delays.lines; beam++) {
+
+            RFFrame& frame = frames[beam];
+            frame.channels = beamformer.GetChannelCount();
+            frame.samples = 512;
+            frame.data.assign(frame.channels * frame.samples, 0.0f);
+
+            // a group output is the mean of its elements once the ASIC has delayed them
+            for(size_t el = 0; el < 16 * 64; el++) {
+
+                const double at = ECHO - early(beam, el) + (elements ? 0.0 : fine(beam, el));
+                float* const rf = frame.data.data() + (elements ? el : el / 16) * frame.samples;
+                for(size_t n = 0; n < frame.samples; n++)
+                    rf[n] += Pulse(double(n) - at) / (elements ? 1.0f : 16.0f);
+
+            }
+        }
+
+        BeamformedFrame image;
+        beamformer.Form(frames, delays, image, pool);
+
+        for(size_t line = 0; line < image.lines; line++)
+            if(*std::max_element(image.GetLine(line), image.GetLine(line) + image.samples) < 0.8f * float(frames[line].channels))
+                return false;
+
+    }
+
+    return true;
+
+}
+
+bool BeamformerTester::TestPointTarget() {
+
+    const Beamformer beamformer(TransducerParams{}, SAMPLE_RATE_HZ, 12.5, Beamformer::GROUPS);
+    constexpr double ECHO = 100.0;
+
+    RFFrame frame;
+    frame.channels = beamformer.GetChannelCount();
+    frame.samples = 256;
+    frame.data.resize(frame.channels * frame.samples);
+
+    DelayTable delays;
+    delays.lines = 1;
+    delays.channels = frame.channels;
+    delays.samples.resize(frame.channels);
+
+    for(size_t channel = 0; channel < frame.channels; channel++) {
+
+        // the echo reaches each group early by a different amount, the beamformer delays it back
+        const double early = 0.37 * double(channel) - 7.0;
+        delays.samples[channel] = float(early);
+        for(size_t n = 0; n < frame.samples; n++)
+            frame.data[channel * frame.samples + n] = Pulse(double(n) - (ECHO - early));
+
+    }
+
+    ThreadPool pool(2);
+    BeamformedFrame image;
+    beamformer.Form(frame, delays, image, pool);
+
+    const float* const line = image.GetLine(0);
+    const size_t peak = size_t(std::max_element(line, line + image.samples) - line);
+
+    float weights = 0.0f;
+    for(const float weight: beamformer.GetApodization())
+        weights += weight;
+
+    return image.lines == 1 && image.samples == frame.samples && peak == size_t(ECHO) && std::abs(line[peak] - weights) < 0.1f * weights;
+
+}
+
+bool BeamformerTester::TestReference() {
+
+    const Beamformer beamformer(TransducerParams{}, SAMPLE_RATE_HZ, 12.5);
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> delay(-40.0f, 40.0f);
+
+    RFFrame frame;
+    frame.channels = beamformer.GetChannelCount();
+    frame.samples = ODD_SAMPLES;
+    frame.data = MakeNoise(frame.channels * frame.samples, random);
+
+    DelayTable delays;
+    delays.lines = 5;
+    delays.channels = frame.channels;
+    delays.samples.resize(delays.lines * delays.channels);
+    std::generate(delays.samples.begin(), delays.samples.end(), [&] { return delay(random); });
+    delays.samples[0] = 12.0f;    // on a sample
+    delays.samples[1] = -250.0f;  // past the end
+    delays.samples[2] = 250.0f;   // past the start
+
+    ThreadPool pool(3);
+    BeamformedFrame image;
+    beamformer.Form(frame, delays, image, pool);
+
+    for(size_t line = 0; line < delays.lines; line++) {
+        for(size_t n = 0; n < frame.samples; n++) {
+
+            double expected = 0.0;
+            for(size_t channel = 0; channel < frame.channels; channel++) {
+
+                // rf(t) between the samples either side of it, past the ends of the frame there is nothing
+                const double t = double(n) - delays.samples[line * delays.channels + channel];
+                const double before = std::floor(t);
+                const double frac = t - before;
+                const float* const rf = frame.GetChannel(channel);
+                const auto sample = [&](const double i) { return i >= 0 && i < double(frame.samples) ? double(rf[size_t(i)]) : 0.0; };
+
+                expected += beamformer.GetApodization()[channel] * (sample(before) * (1.0 - frac) + sample(before + 1) * frac);
+
+            }
+
+            if(std::abs(image.GetLine(line)[n] - expected) > 1e-3)
+                return false;
+
+        }
+    }
+
+    return true;
+
+}
+
+bool BeamformerTester::TestScanPointTarget() {
+
+    constexpr TransducerParams transducer{};
+    const double scale = scan.rxparams.delay_res_ns * 1e-9 * SAMPLE_RATE_HZ;
+    ThreadPool pool(3);
+
+    // an echo from along the beam reaches each element early by how far out along the beam it sits
+    const auto data = Controller<scan, transducer>::CalcScanData();
+    const auto early = [&](const size_t beam, const size_t el) {
+
+        const BeamGeometry geometry = GetBeamGeometry(scan, int(beam % scan.x_steps), int(beam / scan.x_steps));
+        const size_t group = el / 16;
+        const double x = double(group % transducer.xgroups * transducer.xelems + el % 16 / transducer.yelems) - (transducer.xgroups * transducer.xelems - 1) / 2.0;
+        const double y = double(group / transducer.xgroups * transducer.yelems + el % 16 % transducer.yelems) - (transducer.ygroups * transducer.yelems - 1) / 2.0;
+        const double along = x * std::sin(geometry.x_deg * std::numbers::pi / 180.0) + y * std::sin(geometry.y_deg * std::numbers::pi / 180.0);
+        return along * transducer.pitch_nm * 1e-9 / transducer.soundspeed * SAMPLE_RATE_HZ;
+
+    };
+
+    if(!LinesUp(*data, early, [&](const size_t beam, const size_t el) { return data->rxdelays[beam][el] * scale; }, pool))
+        return false;
+
+    // the taylor delays cover the whole aperture, put the echo where they say it is, group (x, y) on the asic is (y, x) here
+    const auto taylor = Controller<TAYLOR, transducer>::CalcScanData();
+    std::vector<std::array<double, 16 * 64>> delays(taylor->rxcoeffs.size());
+    for(size_t beam = 0; beam < delays.size(); beam++) {
+
+        QuantDelays asic;
+        QuantPhases phases;
+        TaylorKernel::UncompressRx(taylor->rxcoeffs[beam], asic, phases);
+
+        for(size_t index = 0; index < asic.size(); index++) {
+
+            const size_t x = index / 16 % 16, y = index / 256, e = index % 16;
+            delays[beam][(x * 4 + y) * 16 + e % 4 * 4 + e / 4] = asic[index] * scale;
+
+        }
+    }
+
+    const auto fine = [&](const size_t beam, const size_t el) { return delays[beam][el]; };
+    if(!LinesUp(*taylor, fine, fine, pool))
+        return false;
+
+    RFFrame frame;
+    frame.channels = 1024;
+    frame.samples = 16;
+    frame.data.resize(frame.channels * frame.samples);
+
+    try {
+        const Beamformer beamformer(transducer, SAMPLE_RATE_HZ, scan.rxparams.delay_res_ns, Beamformer::GROUPS);
+        BeamformedFrame image;
+        beamformer.Form(frame, beamformer.GetDelays(*data), image, pool);
+    }
+    catch(const ConfigException&) {
+        return true;
+    }
+
+    return false;
+
+}
@@ -0,0 +1,53 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-26
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "Beamformer.hpp"
+#include "../Noise.hpp"
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the Delay and Sum Beamformer on Synthetic RF
+     * 
+     */
+    class BeamformerTester {
+
+    public:
+
+        /**
+         * \brief Tests that Delayed Echoes of a Point are Lined Back Up
+         * \test Delays a Pulse by a Different Fraction of a Sample on Every Group, Beamforms it With the Same Delays and Looks for the Peak
+         * \return true: If the Peak is Where the Pulse was and as Tall as the Summed Weights
+         * \return false: If it Moved or Spread Out
+         */
+        bool TestPointTarget();
+
+        /**
+         * \brief Tests the Vectorized Lines Against a Plain Delay and Sum
+         * \test Beamforms Noise on Every Element Over a Thread Pool, With Delays Past Both Ends of the Frame, and Sums it the Slow Way
+         * \return true: If Every Sample Matches
+         * \return false: If a Sample Differs
+         */
+        bool TestReference();
+
+        /**
+         * \brief Tests that the Delays of a Scan Steer Every Beam, Across the Groups as Well as Within Them
+         * \test Echoes a Point Along Every Beam of a Small Delay Scan Onto the Elements and, Through the Fine Delays, the Group Outputs, Beamforms Both With the Scan's Delays, Does the Same Where the Taylor Delays of the Scan Say the Echo is, Then Forms a Frame With the Wrong Channels
+         * \return true: If Every Line Peaks as Tall as its Channels Summed and the Bad Frame Threw
+         * \return false: If a Line Didn't Line Up or the Bad Frame was Formed
+         */
+        bool TestScanPointTarget();
+
+    };
+
+}
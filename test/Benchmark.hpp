@@ -0,0 +1,88 @@
+/**
+ * \file Benchmark.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief Focal Points and Timing Shared by the Controller Benchmarks and the Compression Report in bench/
+ * \version 0.1
+ * \date 2022-05-14
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "Controller.hpp"
+#include "Kernels.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace SoundCath {
+
+/**
+ * \brief Makes a Focal Point for Every Beam of the Scan at a Depth, With the Beam Directions of the Scan Data
+ *
+ * \param[in] params: The Scan Grid
+ * \param[in] depth_m: How Far Out the Foci are in Meters
+ * \return std::vector<FocalPoint>: The Focal Points, in Scan Data Order
+ */
+inline std::vector<FocalPoint> MakeFoci(const ControllerParams& params, const double depth_m) {
+
+    ControllerParams at = params;
+    at.focus_tx = depth_m;
+
+    std::vector<FocalPoint> foci;
+    foci.reserve(size_t(params.x_steps) * params.y_steps);
+
+    for(int j = 0; j < params.y_steps; j++)
+        for(int i = 0; i < params.x_steps; i++) {
+
+            const BeamGeometry beam = GetBeamGeometry(at, i, j);
+            foci.push_back({ beam.txx, beam.txy, beam.txz });
+
+        }
+
+    return foci;
+
+}
+
+/// How Fast Beams Were Compressed and Decompressed
+struct CompressionRates {
+
+    double compress;    ///< Beams Compressed per Second
+    double decompress;  ///< Beams Decompressed per Second
+    int64_t sink;       ///< Sum of a Delay From Every Beam, Print it so the Decompression isn't Thrown Away
+
+};
+
+/**
+ * \brief Times Compressing Every Focal Point, Then Decompressing Every Result, on One Thread
+ *
+ * \param[in] foci: What to Compress
+ * \param[in] compress: Makes the Coefficients for a Focal Point
+ * \param[in] uncompress: Decompresses the Coefficients of the Beam at an Index and Returns a Delay From it
+ * \return CompressionRates: The Throughput Both Ways
+ */
+template<typename Compress, typename Uncompress>
+CompressionRates TimeCompression(const std::vector<FocalPoint>& foci, const Compress& compress, const Uncompress& uncompress) {
+
+    std::vector<decltype(compress(foci.front()))> coeffs(foci.size());
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for(size_t i = 0; i < foci.size(); i++)
+        coeffs[i] = compress(foci[i]);
+
+    const auto compressed = std::chrono::high_resolution_clock::now();
+    int64_t sink = 0;
+    for(size_t i = 0; i < foci.size(); i++)
+        sink += uncompress(coeffs[i], i);
+
+    const auto stop = std::chrono::high_resolution_clock::now();
+
+    const auto rate = [&foci](const auto from, const auto to) { return foci.size() / std::chrono::duration<double>(to - from).count(); };
+    return { rate(start, compressed), rate(compressed, stop), sink };
+
+}
+
+}
@@ -0,0 +1,35 @@
+/**
+ * \file Box.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief The Simulated USX Box Every Hardware Test Runs Against
+ * \version 0.1
+ * \date 2022-05-16
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "Simulator.hpp"
+
+#include <memory>
+
+namespace SoundCath {
+
+/**
+ * \brief Makes a Simulator to Hand to a Driver and Keeps a Handle to it so the Tests can Poke at it
+ *
+ * \param[out] box: The Simulator, Owned by Whoever Takes the Transport
+ * \param[in] config: How the Simulator Behaves
+ * \return std::unique_ptr<Transport>: The Simulator as the Driver Takes it
+ */
+inline std::unique_ptr<Transport> MakeBox(Simulator*& box, const Simulator::Config& config = Simulator::Config()) {
+
+    auto sim = std::make_unique<Simulator>(config);
+    box = sim.get();
+    return sim;
+
+}
+
+}
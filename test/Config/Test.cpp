@@ -0,0 +1,150 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-22
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+#include "Exception.hpp"
+
+#include <algorithm>
+#include <string>
+
+using SoundCath::ConfigTester;
+using SoundCath::ConfigException;
+using SoundCath::ControllerParams;
+using SoundCath::TransducerParams;
+using SoundCath::USParams;
+
+/// Values With Fractions That Aren't Exact in Binary, so the Rounding Shows
+static constexpr std::string_view PRECISE =
+    "attenuation = 0.1\n"
+    "freq_cent_mhz = 7.8125e-1\n"
+    "[transducer]\n"
+    "soundspeed = 1540.123456789\n"
+    "[controller.rx]\n"
+    "start_depth_m = .0025\n"
+    "[asic.core]\n"
+    "ISelLNA = 15\n";
+
+/// A Small Scan in Taylor Mode
+static constexpr ControllerParams taylor = [] { ControllerParams p{}; p.x_steps = 4; p.y_steps = 3; return p; }();
+
+/// The Same Scan in Delay Mode
+static constexpr ControllerParams delays = [] { ControllerParams p = taylor; p.usedelays = true; return p; }();
+
+bool ConfigTester::TestParse() {
+
+    const USParams params = SoundCath::ParseParams(
+        "# a preset\n"
+        "attenuation = 1.0   # water\n"
+        "\n"
+        "[controller]\n"
+        "x_steps = 32\n"
+        "usedelays = true\n"
+        "[controller.tx]\n"
+        "delay_res_ns = 25.0\r\n"
+        "[ asic ]\n"
+        "speed = 100\n"
+        "[asic.core]\n"
+        "  ResCal = 7\n"
+        "CWEn = true\n");
+
+    const USParams defaults{};
+    return params.attenuation == 1.0f && params.conparams.x_steps == 32 && params.conparams.usedelays &&
+        params.conparams.txparams.delay_res_ns == 25.0 && params.asicparams.speed == SoundCath::ASICParams::HIGH &&
+        params.asicparams.core.ResCal == 7 && params.asicparams.core.CWEn &&
+        params.conparams.y_steps == defaults.conparams.y_steps && params.trparams == defaults.trparams &&
+        params.conparams.rxparams == defaults.conparams.rxparams;
+
+}
+
+bool ConfigTester::TestErrors() {
+
+    const auto rejected = [](const char* text) {
+        try {
+            (void)SoundCath::ParseParams(text);
+        }
+        catch(const ConfigException&) {
+            return true;
+        }
+        return false;
+    };
+
+    return rejected("[controller]\nx_stepz = 4\n") && rejected("[controller]\nx_steps = 300\n") &&
+        rejected("[controller]\nx_steps = 0\n") && rejected("[asic.core]\nCWEn = yes\n") &&
+        rejected("[asic]\nspeed = 50\n") && rejected("attenuation 1.0\n") && rejected("[controller\n") &&
+        rejected("[transducer]\nsoundspeed = 1540m\n") && rejected("[asic.core]\nISelLNA = 16\n") &&
+        rejected("[asic.core]\nResCal = 8\n") && rejected("[pulse]\nsubtype = 12\n") && rejected("[asic.core]\nResCal = -1\n");
+
+}
+
+bool ConfigTester::TestCompileTime() {
+
+    constexpr USParams fixed = SoundCath::ParseParams(PRECISE);
+    static_assert(fixed.asicparams.core.ISelLNA == 15 && fixed.asicparams.core.ResCal == USParams{}.asicparams.core.ResCal);
+
+    const std::string text(PRECISE); // so it can only be parsed at runtime
+    const USParams runtime = SoundCath::ParseParams(text);
+
+    return fixed.attenuation == 0.1f && fixed.freq_cent_mhz == 7.8125e-1 && fixed.trparams.soundspeed == 1540.123456789 &&
+        fixed.conparams.rxparams.start_depth_m == .0025 && runtime.attenuation == fixed.attenuation &&
+        runtime.freq_cent_mhz == fixed.freq_cent_mhz && runtime.trparams == fixed.trparams &&
+        runtime.conparams.rxparams == fixed.conparams.rxparams && runtime.asicparams.core.ISelLNA == 15 &&
+        ScanKernels::Supports(SoundCath::PRESET.trparams, SoundCath::PRESET.conparams);
+
+}
+
+/**
+ * \brief Compares Every Table a Scan Calculated by the Templated Controller has With the Runtime One
+ *
+ * \param[in] fixed: From \ref Controller::CalcScanData
+ * \param[in] run: From \ref ScanKernels::CalcScanData
+ * \return true: If the Tables are the Same
+ */
+template<typename Fixed>
+static bool SameTables(const Fixed& fixed, const SoundCath::RuntimeScanData& run) {
+
+    const auto same = [](const auto& a, const auto& b) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); };
+
+    if constexpr (requires { fixed.txdelays; })
+        return run.usedelays && same(fixed.txdelays, run.txdelays) && same(fixed.rxdelays, run.rxdelays);
+    else
+        return !run.usedelays && same(fixed.txcoeffs, run.txcoeffs) && same(fixed.rxcoeffs, run.rxcoeffs) &&
+            same(fixed.txoffsets, run.txoffsets) && same(fixed.rxgroupdelays, run.rxgroupdelays);
+
+}
+
+bool ConfigTester::TestScanKernels() {
+
+    ThreadPool pool(2);
+
+    if(!SameTables(*Controller<taylor, TransducerParams{}>::CalcScanData(pool), *ScanKernels::CalcScanData(TransducerParams{}, taylor, pool)) ||
+       !SameTables(*Controller<delays, TransducerParams{}>::CalcScanData(pool), *ScanKernels::CalcScanData(TransducerParams{}, delays, pool)))
+        return false;
+
+    // the whole preset grid, what ScanGen builds in
+    if(!SameTables(*Controller<SoundCath::PRESET.conparams, SoundCath::PRESET.trparams>::CalcScanData(pool),
+                   *ScanKernels::CalcScanData(SoundCath::PRESET.trparams, SoundCath::PRESET.conparams, pool)))
+        return false;
+
+    TransducerParams unknown{};
+    unknown.soundspeed = 1540.0;
+    if(ScanKernels::Supports(unknown, taylor))
+        return false;
+
+    try {
+        (void)ScanKernels::CalcScanData(unknown, taylor, pool);
+    }
+    catch(const ConfigException&) {
+        return true;
+    }
+
+    return false;
+
+}
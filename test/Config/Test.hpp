@@ -0,0 +1,62 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-22
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "Config.hpp"
+#include "Preset.hpp"
+#include "ScanKernels.hpp"
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the Config File Loader and the Runtime Scan Kernels
+     * 
+     */
+    class ConfigTester {
+
+    public:
+
+        /**
+         * \brief Tests that a Config File Sets the Fields it Names and Leaves the Rest at Their Defaults
+         * \test Parses a File With Comments, Sections and Every Kind of Value
+         * \return true: If the Test Passes
+         * \return false: If a Field is Wrong
+         */
+        bool TestParse();
+
+        /**
+         * \brief Tests that Bad Files are Rejected
+         * \test Unknown Keys, Values That Don't Fit, Bad Lines, a Bad Clock Speed and Out of Range Currents Should Each Throw
+         * \return true: If Every Bad File Threw
+         * \return false: If One Was Accepted
+         */
+        bool TestErrors();
+
+        /**
+         * \brief Tests that a Preset Parsed While Compiling Comes Out the Same as One Parsed at Runtime
+         * \test Parses Values That Round Both Ways and Checks They Match Each Other and the Compiler's Own Literals
+         * \return true: If the Test Passes
+         * \return false: If a Value Differs or the Built in Preset Has No Scan Kernel
+         */
+        bool TestCompileTime();
+
+        /**
+         * \brief Tests that the Runtime Scan Data Matches the Templated Controller
+         * \test Calculates a Small Scan Both Ways in Taylor and Delay Mode and the Whole Preset Scan, Then Checks an Unknown Probe is Refused
+         * \return true: If the Tables are the Same
+         * \return false: If a Beam Differs or the Unknown Probe Was Accepted
+         */
+        bool TestScanKernels();
+
+    };
+
+}
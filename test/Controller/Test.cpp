@@ -10,19 +10,300 @@
  */
 
 #include "Test.hpp"
+#include "Kernels.hpp"
+#include "../Benchmark.hpp"
 
-#include <chrono>
+#include <cstring>
+#include <memory>
+#include <cmath>
+#include <filesystem>
+#include <algorithm>
+#include <vector>
+
+#include <fmt/format.h>
 
 using SoundCath::ControllerTester;
 using SoundCath::RXControllerTester;
+using SoundCath::TXControllerTester;
+using SoundCath::ControllerParams;
+using SoundCath::TransducerParams;
+
+/**
+ * \brief Makes Focal Points Over the Default Scan Grid at 5cm, Round and Round Until There are Enough, for the Benchmarks
+ *
+ * \param[in] size: How Many Focal Points
+ * \return std::vector<FocalPoint>: The Focal Points
+ */
+static std::vector<SoundCath::FocalPoint> SpreadFoci(const uint32_t size) {
+
+    const auto grid = SoundCath::MakeFoci(ControllerParams{}, 0.05);
+    std::vector<SoundCath::FocalPoint> foci(size);
+
+    for(uint32_t i = 0; i < size; i++)
+        foci[i] = grid[i % grid.size()];
+
+    return foci;
+
+}
 
 template<ControllerParams::RxParams params, TransducerParams tparams>
 void RXControllerTester<params, tparams>::Benchmark(const uint32_t size) {
 
-    static auto start = std::chrono::high_precision_clock
+    QuantDelays delays;
+    QuantPhases phases;
+
+    const auto rates = TimeCompression(SpreadFoci(size),
+        [](const FocalPoint& focus) { return RXController<params, tparams>::CompressTaylor(focus.x, focus.y, focus.z); },
+        [&](const RxCoeffs& coeffs, const size_t i) { TaylorKernel::UncompressRx(coeffs, delays, phases); return delays[i % delays.size()]; });
+
+    fmt::print("RX: {} Beams, Compression {:.0f} Beams/s, Decompression {:.0f} Beams/s ({})\n", size, rates.compress, rates.decompress, rates.sink);
+
+}
+
+template<ControllerParams::TxParams params, TransducerParams tparams>
+void TXControllerTester<params, tparams>::Benchmark(const uint32_t size) {
+
+    QuantDelays delays;
+
+    const auto rates = TimeCompression(SpreadFoci(size),
+        [](const FocalPoint& focus) { return TXController<params, tparams>::CompressTaylor(focus.x, focus.y, focus.z, 0).coeffs; },
+        [&](const TxCoeffs& coeffs, const size_t i) { TaylorKernel::UncompressTx(coeffs, delays); return delays[i % delays.size()]; });
+
+    fmt::print("TX: {} Beams, Compression {:.0f} Beams/s, Decompression {:.0f} Beams/s ({})\n", size, rates.compress, rates.decompress, rates.sink);
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool ControllerTester<params, tparams>::TestRuntimeScanData() {
+
+    static constexpr auto compiled = Controller<params, tparams>::PreCalcScanData();
+    const auto runtime = Controller<params, tparams>::CalcScanData();
+
+    // compare bytes, == would call -0.0 and 0.0 the same
+    const auto same = [](const auto& a, const auto& b) { return std::memcmp(a.data(), b.data(), sizeof(a)) == 0; };
+
+    if constexpr (params.usedelays)
+        return same(compiled.txdelays, runtime->txdelays) && same(compiled.rxdelays, runtime->rxdelays) &&
+            same(compiled.rxgroupdelays, runtime->rxgroupdelays);
+    else
+        return same(compiled.txcoeffs, runtime->txcoeffs) && same(compiled.rxcoeffs, runtime->rxcoeffs) &&
+            same(compiled.txoffsets, runtime->txoffsets) && same(compiled.rxgroupdelays, runtime->rxgroupdelays);
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool ControllerTester<params, tparams>::TestScanCache() {
+
+    const auto directory = std::filesystem::temp_directory_path() / "SoundCathScanCacheTest";
+    std::filesystem::remove_all(directory);
+
+    const auto expected = Controller<params, tparams>::CalcScanData();
+    std::filesystem::path path;
+    const auto matches = [&expected](const ScanData<params, tparams>& data) { return std::memcmp(&data, expected.get(), sizeof(data)) == 0; };
+
+    { // every cache is closed before the file is touched again, Windows won't truncate or replace a mapped file
+
+        ScanCache<params, tparams> first(directory);
+        if(!matches(first.Get()) || !first.IsMapped()) // calculated, written then mapped
+            return false;
+
+    }
+
+    {
+
+        ScanCache<params, tparams> second(directory);
+        if(!matches(second.Get()) || !second.IsMapped())
+            return false;
+
+        path = second.GetPath();
+
+    }
+
+    std::filesystem::resize_file(path, 100); // a cut off file has to be recalculated, not mapped
+
+    bool rebuilt = false;
+
+    {
+
+        ScanCache<params, tparams> third(directory);
+        rebuilt = matches(third.Get()) && third.IsMapped() &&
+            std::filesystem::file_size(path) == sizeof(typename ScanCache<params, tparams>::Header) + sizeof(ScanData<params, tparams>);
+
+    }
+
+    std::filesystem::remove_all(directory);
+    return rebuilt;
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool ControllerTester<params, tparams>::TestScanBlob() {
+
+    using Cache = ScanCache<params, tparams>;
+    using Header = typename Cache::Header;
+
+    const auto expected = Controller<params, tparams>::CalcScanData();
+    const auto header = Cache::MakeHeader();
+
+    auto blob = std::make_unique<Header[]>(1 + (sizeof(ScanData<params, tparams>) + sizeof(Header) - 1) / sizeof(Header)); // aligned like ScanGen's array
+    std::byte* const bytes = reinterpret_cast<std::byte*>(blob.get());
+    std::memcpy(bytes, &header, sizeof(header));
+    std::memcpy(bytes + sizeof(header), expected.get(), sizeof(ScanData<params, tparams>));
+
+    const size_t size = sizeof(Header) + sizeof(ScanData<params, tparams>);
+    const ScanData<params, tparams>* const data = Cache::Check(bytes, size);
+    if(!data || std::memcmp(data, expected.get(), sizeof(*data)) || Cache::Check(bytes, size - 1))
+        return false;
+
+    Header other = header;
+    other.key++;
+    std::memcpy(bytes, &other, sizeof(other));
+    return Cache::Check(bytes, size) == nullptr;
+
+}
+
+template<ControllerParams params, TransducerParams tparams>
+bool ControllerTester<params, tparams>::TestUncompressScanData() {
+
+    const auto data = Controller<params, tparams>::CalcScanData();
+    ThreadPool pool;
+    const auto decompressed = Controller<params, tparams>::UncompressScanData(*data, pool);
+
+    for(size_t beam = 0; beam < ScanData<params, tparams>::BEAMS; beam++) {
+
+        const auto rx = RXController<params.rxparams, tparams>::UncompressTaylor(data->rxcoeffs[beam]);
+        if(decompressed->txdelays[beam] != TXController<params.txparams, tparams>::UncompressTaylor(data->txcoeffs[beam]) ||
+            decompressed->rxdelays[beam] != rx.delays || decompressed->rxphases[beam] != rx.phases)
+            return false;
+
+    }
+
+    return true;
+
+}
+
+template<ControllerParams::RxParams params, TransducerParams tparams>
+bool RXControllerTester<params, tparams>::TestTaylorDecompression() noexcept {
+
+    QuantDelays delays;
+    QuantPhases phases;
+
+    // all zero is every element on the middle curve at the center delay
+    TaylorKernel::UncompressRx(RxCoeffs{}, delays, phases);
+    if(std::any_of(delays.begin(), delays.end(), [](const int16_t d) { return d != 14; }) ||
+        std::any_of(phases.begin(), phases.end(), [](const int8_t p) { return p != 4; }))
+        return false;
+
+    uint32_t seed = 12345;
+    const auto next = [&seed](const int low, const int high) { seed = seed * 1664525 + 1013904223; return int16_t(low + int((seed >> 8) % uint32_t(high - low + 1))); };
+
+    for(int trial = 0; trial < 1000; trial++) {
+
+        const int16_t scales[] = { 1, 4, 8, 16 };
+        RxCoeffs coeffs;
+        for(size_t i = 0; i < 9; i++)
+            coeffs[i] = next(-128, 127);
+        coeffs[9] = scales[next(0, 3)];
+
+        const auto reference = RXController<params, tparams>::UncompressTaylor(coeffs);
+        TaylorKernel::UncompressRx(coeffs, delays, phases);
+        if(delays != reference.delays || phases != reference.phases)
+            return false;
+
+    }
+
+    return true;
+
+}
+
+template<ControllerParams::TxParams params, TransducerParams tparams>
+bool TXControllerTester<params, tparams>::TestTaylorDecompression() {
+
+    QuantDelays delays;
+
+    // the spec says all zero coefficients fire every element at 15
+    TaylorKernel::UncompressTx(TxCoeffs{}, delays);
+    if(std::any_of(delays.begin(), delays.end(), [](const int16_t d) { return d != 15; }))
+        return false;
+
+    uint32_t seed = 54321;
+    const auto next = [&seed](const int low, const int high) { seed = seed * 1664525 + 1013904223; return int16_t(low + int((seed >> 8) % uint32_t(high - low + 1))); };
+
+    for(int trial = 0; trial < 1000; trial++) {
+
+        TxCoeffs coeffs;
+        coeffs[0] = next(0, 255);
+        for(size_t i = 1; i < coeffs.size(); i++)
+            coeffs[i] = next(-128, 127);
+
+        TaylorKernel::UncompressTx(coeffs, delays);
+        if(delays != TXController<params, tparams>::UncompressTaylor(coeffs))
+            return false;
+
+    }
+
+    return true;
+
+}
+
+template<ControllerParams::TxParams params, TransducerParams tparams>
+bool TXControllerTester<params, tparams>::TestGenerateDelays() {
+
+    const TxDelayKernel kernel(tparams, params.delay_res_ns);
+    const FocalPoint foci[] = { { 0.0, 0.0, 0.05 }, { 0.01, -0.005, 0.04 }, { -0.02, 0.02, 0.1 }, { 0.001, 0.002, 0.003 } };
+
+    for(const auto& focus: foci) {
+
+        Delays fast;
+        kernel.Calculate(focus, fast);
+        const Delays reference = TXController<params, tparams>::CalculateDelays(focus.x, focus.y, focus.z);
+
+        for(size_t i = 0; i < fast.size(); i++)
+            if(std::abs(fast[i] - reference[i]) > 1e-3) // the kernel is single precision, its worst is about 3e-4
+                return false;
+
+    }
+
+    return true;
+
+}
+
+template<ControllerParams::TxParams params, TransducerParams tparams>
+bool TXControllerTester<params, tparams>::TestDelayOffset() {
+
+    const double unit = tparams.soundspeed * params.delay_res_ns * 1e-9; // meters per delay step
+    const FocalPoint foci[] = { { 0.0, 0.0, 0.05 }, { 0.01, -0.005, 0.04 }, { -0.02, 0.02, 0.1 }, { 0.03, 0.0, 0.01 } };
+
+    for(const auto& focus: foci) {
+
+        const Delays delays = TXController<params, tparams>::CalculateDelays(focus.x, focus.y, focus.z);
+        const double r = std::sqrt(focus.x * focus.x + focus.y * focus.y + focus.z * focus.z);
+
+        // the path differences on their own, before any offset
+        Delays raw{};
+        for(int yg = 0; yg < tparams.ygroups; yg++)
+            for(int xg = 0; xg < tparams.xgroups; xg++)
+                for(int elx = 0; elx < tparams.xelems; elx++)
+                    for(int ely = 0; ely < tparams.yelems; ely++) {
+
+                        const double x = ((xg - tparams.xgroups/2 - .5) * tparams.group_pitch_nm + (elx - tparams.xelems/2 - .5) * tparams.pitch_nm) * 1e-9;
+                        const double y = ((yg - tparams.ygroups/2 - .5) * tparams.group_pitch_nm + (ely - tparams.yelems/2 - .5) * tparams.pitch_nm) * 1e-9;
+                        raw[elx * tparams.yelems + ely + (yg * tparams.xgroups + xg) * tparams.elempergroup] =
+                            (r - std::sqrt((focus.x - x) * (focus.x - x) + (focus.y - y) * (focus.y - y) + focus.z * focus.z)) / unit;
+
+                    }
 
+        // every element moves by the same amount, so the steering is what it was, and the earliest lands exactly on 0
+        const double shift = -*std::min_element(raw.begin(), raw.end());
+        if(*std::min_element(delays.begin(), delays.end()) != 0.0)
+            return false;
 
+        for(size_t i = 0; i < delays.size(); i++)
+            if(std::abs(delays[i] - raw[i] - shift) > 1e-9)
+                return false;
 
+    }
 
-};
+    return true;
 
+}
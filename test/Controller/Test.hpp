@@ -10,29 +10,11 @@
  */
 
 #include "Controller.hpp"
+#include "ScanCache.hpp"
 #include "Parameters.hpp"
 
 namespace SoundCath {
 
-/**
- * \brief Tests the Controller Class For Its Functionality, RX and TX plus Queueing
- * 
- * \tparam params: What Controller Params to test the Controller With
- * \tparam tparams: What Transducer to test the Controller With
- */
-template<ControllerParams params, TransducerParams tparams>
-class ControllerTester {
-
-
-
-
-private:
-
-    RXControllerTester<params, tparams> rxtester;
-    TXControllerTester<params, tparams> txtester;
-
-};
-
 /**
  * \brief Tests the Functionality of the RX Controller Class
  * 
@@ -53,10 +35,10 @@ public:
     bool TestTaylorCompression() noexcept;
 
     /**
-     * \brief 
-     * \test 
-     * \return true 
-     * \return false 
+     * \brief Tests the Vectorized Rx Decompression Against \ref RXController::UncompressTaylor
+     * \test All Zero Coefficients Have to Give the Center Delay and Curve, Then Random Coefficients Have to Match the Reference Exactly
+     * \return true: If Every Delay and Phase Matches
+     * \return false: If Any Differ
      */
     bool TestTaylorDecompression() noexcept;
 
@@ -77,9 +59,9 @@ public:
     bool TestDynTaylorDecompression() noexcept;
 
     /**
-     * \brief 
+     * \brief Times Compressing and Decompressing Beams Spread Over the Scan Area and Prints the Throughput
      * 
-     * \param size
+     * \param[in] size: How Many Beams to Time
      */
     void Benchmark(const uint32_t size);
 
@@ -96,7 +78,7 @@ private:
 
 };
 
-template<ControllerParams::RxParams params, TransducerParams tparams>
+template<ControllerParams::TxParams params, TransducerParams tparams>
 class TXControllerTester {
 
 public:
@@ -110,10 +92,10 @@ public:
     bool TestTaylorCompression();
 
     /**
-     * \brief 
-     * 
-     * \return true 
-     * \return false 
+     * \brief Tests the Vectorized Tx Decompression Against \ref TXController::UncompressTaylor
+     * \test All Zero Coefficients Have to Give 15 Everywhere, Then Random Coefficients Have to Match the Reference Exactly
+     * \return true: If Every Delay Matches
+     * \return false: If Any Differ
      */
     bool TestTaylorDecompression();
 
@@ -134,17 +116,25 @@ public:
     bool TestDynTaylorDecompression();
 
     /**
-     * \brief 
-     * 
-     * \return true 
-     * \return false 
+     * \brief Tests the Vectorized Delay Kernel Against \ref TXController::CalculateDelays
+     * \test Calculates the Delays for a Few Focal Points Both Ways, They Have to Agree to a Thousandth of the Resolution
+     * \return true: If Every Delay Agrees
+     * \return false: If Any Delay is Off
      */
     bool TestGenerateDelays();
 
     /**
-     * \brief 
+     * \brief Tests that \ref TXController::CalculateDelays Only Shifts the Path Differences, so the Steering Doesn't Change
+     * \test Works Out the Path Differences for a Few Focal Points, Some Steered Past 127 Steps, and Checks Every Delay is Them Plus One Shift
+     * \return true: If the Earliest Element is at Exactly 0 and Every Element Moved by the Same Amount
+     * \return false: If Any Element Moved Differently
+     */
+    bool TestDelayOffset();
+
+    /**
+     * \brief Times Compressing and Decompressing Beams Spread Over the Scan Area and Prints the Throughput
      * 
-     * \param size
+     * \param[in] size: How Many Beams to Time
      */
     void Benchmark(const uint32_t size);
 
@@ -154,4 +144,54 @@ private:
 
 };
 
+/**
+ * \brief Tests the Controller Class For Its Functionality, RX and TX plus Queueing
+ * 
+ * \tparam params: What Controller Params to test the Controller With
+ * \tparam tparams: What Transducer to test the Controller With
+ */
+template<ControllerParams params, TransducerParams tparams>
+class ControllerTester {
+
+public:
+
+    /**
+     * \brief Tests that the Runtime Scan Data Matches the Compile Time Scan Data Bit for Bit
+     * \test Calculates the Scan Data Both Ways and Compares the Raw Bytes of Every Calculated Table
+     * \return true: If Every Table is Identical
+     * \return false: If Anything Differs
+     */
+    bool TestRuntimeScanData();
+
+    /**
+     * \brief Tests that the Scan Cache Writes the Scan Data Once and Maps it Back In After That
+     * \test Loads Through a Fresh Cache Directory Twice, Then Truncates the File and Loads Again
+     * \return true: If the Second Load is Mapped, the Bad File is Replaced and the Tables Match the Calculated Ones
+     * \return false: If Anything Else Happens
+     */
+    bool TestScanCache();
+
+    /**
+     * \brief Tests that Scan Data Built in as Bytes, the Way ScanGen Writes it, is Only Used When it is for These Parameters
+     * \test Checks a Header and the Calculated Tables, Then the Same Bytes With Another Key and Cut Short
+     * \return true: If Only the Good Bytes are Accepted and They Point at the Tables
+     * \return false: If Anything Else Happens
+     */
+    bool TestScanBlob();
+
+    /**
+     * \brief Tests Decompressing a Whole Scan Against Decompressing it a Beam at a Time With the Reference
+     * \test Calculates the Scan Data, Decompresses it on a Thread Pool and Checks Every Beam Against \ref TXController::UncompressTaylor and \ref RXController::UncompressTaylor
+     * \return true: If Every Beam Matches
+     * \return false: If Any Beam Differs
+     */
+    bool TestUncompressScanData();
+
+private:
+
+    RXControllerTester<params.rxparams, tparams> rxtester;
+    TXControllerTester<params.txparams, tparams> txtester;
+
+};
+
 }
\ No newline at end of file
@@ -7,4 +7,222 @@
  * 
  * @copyright Copyright (c) 2022
  * 
- */
\ No newline at end of file
+ */
+
+#include "Test.hpp"
+#include "Exception.hpp"
+
+#include <vector>
+#include <future>
+#include <chrono>
+#include <functional>
+#include <filesystem>
+
+using SoundCath::DriverTester;
+using SoundCath::Simulator;
+using SoundCath::Driver;
+
+DriverTester::DriverTester(): box(nullptr), face(MakeBox(box)) {}
+
+bool DriverTester::TestQuery() {
+
+    const std::string response = face.Query("FPGAVersion");
+    return response == "FPGAVersion:RESULT:HW 2, FPGA SVN 2465" && face.GetResult() == "HW 2, FPGA SVN 2465";
+
+}
+
+bool DriverTester::TestSend() {
+
+    const uint64_t before = box->GetCommandCount();
+    face.Send("SetParam:Config,TxClkDivider:16");
+
+    bool threw = false;
+    try {
+        face.Send("NotACommand:1,2,3");
+    }
+    catch(const SoundCath::DriverException&) {
+        threw = true;
+    }
+
+    return threw && box->GetCommandCount() == before + 2 && face.Query("GetParam:Config,TxClkDivider") == "GetParam:RESULT:16";
+
+}
+
+bool DriverTester::TestRecv() {
+
+    face.Send("GetBandgap");
+
+    std::string output;
+    face.Recv(output);
+    return output == "GetBandgap:RESULT: Bandgap Voltage: 1.12V" && face.Recv() == output;
+
+}
+
+bool DriverTester::TestAsyncOrder() {
+
+    face.Send("BmodeClearEntries");
+
+    std::string delays;
+    for(size_t i = 0; i < 1024; i++)
+        delays += (i ? "," : "") + std::to_string(i % 511);
+
+    std::string command = "BmodeQueueASICDelays:" + delays + ':' + delays;
+    std::vector<std::future<std::string>> responses;
+    for(size_t i = 0; i < 3 * Driver::QUEUE_DEPTH; i++) // more than the queue holds so the submitter has to block
+        responses.push_back(face.SendAsync(command));
+
+    face.SendAsync("BmodeQueueUpload");
+
+    // the query has to wait for everything above, or the entry count is short
+    if(face.Query("BmodeGetQueueEntries") != "BmodeGetQueueEntries:RESULT:" + std::to_string(3 * Driver::QUEUE_DEPTH) + " Entries")
+        return false;
+
+    for(auto& response: responses)
+        if(response.get() != "BmodeQueueASICDelays:RESULT: OK")
+            return false;
+
+    return face.Pending() == 0;
+
+}
+
+bool DriverTester::TestAsyncError() {
+
+    face.Send("GetAsicError"); // clear whatever the other tests latched
+    box->InjectErrors(1);
+    auto failed = face.SendAsync("FireSingleElement:0,0");
+    auto passed = face.SendAsync("FireSingleElement:0,1");
+
+    bool threw = false;
+    try {
+        failed.get();
+    }
+    catch(const SoundCath::DriverException&) {
+        threw = true;
+    }
+
+    return threw && passed.get() == "FireSingleElement:RESULT: OK" &&
+        face.Query("GetAsicError") == "GetAsicError:RESULT:ASIC Error Status: 08, FPGA Error Status: 00000000";
+
+}
+
+bool DriverTester::TestRecordReplay() {
+
+    const auto path = std::filesystem::temp_directory_path() / "soundcath-driver-test.rec";
+    const std::vector<std::string> commands { "FPGAVersion", "SetParam:Config,TxClkDivider:16", "GetParam:Config,TxClkDivider", "FireSingleElement:0,0", "GetAsicError" };
+
+    std::vector<std::string> recorded;
+    {
+        auto sim = std::make_unique<Simulator>();
+        Simulator* recordedbox = sim.get();
+        Driver recorder(std::make_unique<SoundCath::RecordingTransport>(std::move(sim), path));
+
+        for(const auto& command: commands) {
+            if(recorded.size() == 1) // the set fails, so an error is in the recording
+                recordedbox->InjectErrors(1);
+
+            try {
+                recorded.push_back(recorder.Query(command));
+            }
+            catch(const SoundCath::DriverException&) {
+                recorded.push_back("threw");
+            }
+        }
+    }
+
+    bool matched = true;
+    uint64_t mismatches = 0;
+    {
+        auto replay = std::make_unique<SoundCath::ReplayTransport>(path);
+        SoundCath::ReplayTransport* player = replay.get();
+        Driver replayer(std::move(replay));
+
+        for(size_t i = 0; i < commands.size(); i++) {
+            std::string response;
+            try {
+                response = replayer.Query(commands[i]);
+            }
+            catch(const SoundCath::DriverException&) {
+                response = "threw";
+            }
+            matched = matched && response == recorded[i];
+        }
+
+        player->Rewind();
+        try {
+            replayer.Send("NotTheFirstCommand");
+        }
+        catch(const SoundCath::DriverException&) {}
+        mismatches = player->GetMismatches();
+    }
+
+    std::filesystem::remove(path);
+    return matched && recorded.front() == "FPGAVersion:RESULT:HW 2, FPGA SVN 2465" && recorded[1] == "threw" && mismatches == 1;
+
+}
+
+bool DriverTester::TestGroupBounds() {
+
+    Simulator::Config config;
+    config.numasics = 2;
+    Driver twoasics(std::make_unique<Simulator>(config));
+
+    // comma separated copies of a value
+    const auto repeat = [](const int value, const size_t count) {
+        std::string list;
+        for(size_t i = 0; i < count; i++)
+            list += (i ? "," : "") + std::to_string(value);
+        return list;
+    };
+
+    const auto fails = [&](const std::string& command) {
+        try {
+            twoasics.Send(command);
+        }
+        catch(const SoundCath::DriverException&) {
+            return true;
+        }
+        return false;
+    };
+
+    const std::string before = twoasics.Query("ReadTxDelays");
+    twoasics.Send("FireGroup:127:" + repeat(3, 16)); // the last group of the second ASIC
+    twoasics.Send("FireGroupReceive:100,100,100:" + repeat(3, 16) + ":" + repeat(2, 16));
+
+    return fails("FireGroup:128:" + repeat(3, 16)) &&
+        fails("FireGroupReceive:0,0,0:" + repeat(7, 16) + ":1,2") &&                     // the rx half is short
+        fails("FireAsicReceive:0,128:" + repeat(7, 1024) + ":" + repeat(2, 16)) &&         // no second group 128
+        twoasics.Query("ReadTxDelays") == before;                                           // ASIC 0 never changed
+
+}
+
+bool DriverTester::TestCallbackReentry() {
+
+    std::promise<int> rejected;
+    face.SendAsync("FPGAVersion", [this, &rejected](const std::string&, uint32_t) {
+
+        int count = 0;
+        const std::vector<std::function<void()>> calls {
+            [this] { face.Send("FPGAVersion"); },
+            [this] { face.Query("FPGAVersion"); },
+            [this] { face.SendAsync("FPGAVersion"); },
+            [this] { face.Flush(); }
+        };
+
+        for(const auto& call: calls) {
+            try {
+                call();
+            }
+            catch(const SoundCath::DriverException&) {
+                count++;
+            }
+        }
+
+        rejected.set_value(count);
+
+    });
+
+    auto count = rejected.get_future();
+    return count.wait_for(std::chrono::seconds(5)) == std::future_status::ready && count.get() == 4 &&
+        face.Query("FPGAVersion") == "FPGAVersion:RESULT:HW 2, FPGA SVN 2465";
+
+}
@@ -12,11 +12,13 @@
 #pragma once 
 
 #include "Driver.hpp"
+#include "../Box.hpp"
+#include "Recorder.hpp"
 
 namespace SoundCath {
 
     /**
-     * \brief 
+     * \brief Tests the Driver Against the Simulated USX Box, so it Runs Without Hardware
      * 
      */
     class DriverTester {
@@ -24,33 +26,80 @@ namespace SoundCath {
     public:
 
         /**
-         * \brief 
+         * \brief Construct a new Driver Tester object, the Driver Runs on a Default Simulator
          * 
-         * \return true 
-         * \return false 
+         */
+        DriverTester();
+
+        /**
+         * \brief Tests that a Query Returns the Documented Response
+         * \test Sends FPGAVersion and Checks the Response and the Result Substring
+         * \return true: If the Test Passes
+         * \return false: If the Response is Wrong
          */
         bool TestQuery();
 
         /**
-         * \brief 
-         * \test 
+         * \brief Tests that Sends Reach the Box and Bad Commands Throw
+         * \test Sends a Valid and an Unknown Command, the Unknown One Should Throw a DriverException
          * \throws DriverException: If the Driver doesn't work for one reason or another
-         * \return true 
-         * \return false 
+         * \return true: If the Test Passes
+         * \return false: If the Box Didn't See the Commands or Nothing was Thrown
          */
         bool TestSend();
 
         /**
-         * \brief 
-         * \test
-         * \return true 
-         * \return false 
+         * \brief Tests that the Last Response can be Received After a Send
+         * \test 
+         * \return true: If the Test Passes
+         * \return false: If the Received String Doesn't Match
          */
         bool TestRecv();
 
+        /**
+         * \brief Tests that Asynchronous Commands Complete in Order and Synchronous Calls Wait for Them
+         * \test Queues a Batch of Delay Commands Asynchronously Then Reads the Queue Back Synchronously
+         * \return true: If the Test Passes
+         * \return false: If a Command was Lost or Reordered
+         */
+        bool TestAsyncOrder();
+
+        /**
+         * \brief Tests that an Injected Error Comes Back Through the Future
+         * \test 
+         * \return true: If the Test Passes
+         * \return false: If the Error Didn't Surface or Leaked to Other Commands
+         */
+        bool TestAsyncError();
+
+        /**
+         * \brief Tests that a Recorded Session Plays Back the Same Responses and Return Codes
+         * \test Records a Few Commands Through a Simulator Including a Failing One, Then Replays Them on a New Driver
+         * \return true: If the Test Passes
+         * \return false: If a Response Differs or a Mismatched Command Wasn't Caught
+         */
+        bool TestRecordReplay();
+
+        /**
+         * \brief Tests the Simulator's Group Checks on a Box With Two ASICs
+         * \test Fires Groups on the Second ASIC and Past the Last One, and Fires With a Bad Second Group or Bad Rx Delays
+         * \return true: If the Second ASIC's Groups Work, the Rest Fail, and a Failed Fire Leaves the Tx Delays Alone
+         * \return false: If a Bad Fire Went Through or Changed the Delays
+         */
+        bool TestGroupBounds();
+
+        /**
+         * \brief Tests that a Callback Calling Back Into the Driver Throws Instead of Deadlocking
+         * \test Sends, Queries, Queues and Flushes From a Callback, Then Sends From the Caller's Thread
+         * \return true: If Every Call From the Callback Threw and the Driver Still Works Afterwards
+         * \return false: If a Call Went Through or the Driver is Stuck
+         */
+        bool TestCallbackReentry();
+
     private:
 
-        SoundCath::Driver face; ///< The Interface to Test
+        SoundCath::Simulator* box;  ///< The Simulated Box, Owned by the Driver
+        SoundCath::Driver face;     ///< The Interface to Test
 
     };
 
@@ -0,0 +1,178 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+using SoundCath::LoggingTester;
+using SoundCath::AsyncAppender;
+
+static const char* const TAG = "LoggingTester::";
+
+/**
+ * \brief Hands a Line to an Appender the Way plog Would
+ *
+ * \param[in] appender: Where it Goes
+ * \param[in] message: What it Says
+ */
+static void Write(AsyncAppender& appender, const std::string& message) {
+
+    plog::Record record(plog::info, "Write", __LINE__, __FILE__, nullptr, 0);
+    record << message;
+    appender.write(record);
+
+}
+
+/**
+ * \brief Reads a Log File Back
+ *
+ * \param[in] path: The File
+ * \return std::vector<std::string>: Every Line in it, Nothing if it isn't There
+ */
+static std::vector<std::string> ReadLines(const std::filesystem::path& path) {
+
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    for(std::string line; std::getline(file, line);)
+        lines.push_back(line);
+
+    return lines;
+
+}
+
+/**
+ * \brief Finds the Numbered Messages in Log Lines, the Formatter Puts a Header in Front of Each
+ *
+ * \param[in] lines: The Lines
+ * \param[in] prefix: What Comes Right Before the Number
+ * \return std::vector<int>: The Numbers, in the Order They Were Written
+ */
+static std::vector<int> Numbers(const std::vector<std::string>& lines, const std::string& prefix) {
+
+    std::vector<int> numbers;
+    for(const auto& line: lines) {
+
+        const size_t at = line.find(prefix);
+        if(at != std::string::npos)
+            numbers.push_back(std::stoi(line.substr(at + prefix.size())));
+
+    }
+
+    return numbers;
+
+}
+
+LoggingTester::LoggingTester(): directory(std::filesystem::temp_directory_path() / "SoundCathLoggingTest") {
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+}
+
+LoggingTester::~LoggingTester() {
+
+    std::error_code error; // the global appender from TestInitLogging may still have a file open, that one stays
+    std::filesystem::remove_all(directory, error);
+
+}
+
+bool LoggingTester::TestWrite() {
+
+    const auto path = directory / "write.log";
+    AsyncAppender appender(path);
+
+    for(int i = 0; i < 500; i++)
+        Write(appender, "message " + std::to_string(i));
+
+    appender.Flush();
+
+    const auto numbers = Numbers(ReadLines(path), "message ");
+    if(numbers.size() != 500 || appender.GetDropped())
+        return false;
+
+    for(int i = 0; i < 500; i++)
+        if(numbers[i] != i)
+            return false;
+
+    return true;
+
+}
+
+bool LoggingTester::TestDropped() {
+
+    constexpr int count = 20000;
+    const auto path = directory / "dropped.log";
+    AsyncAppender appender(path, 2);
+
+    for(int i = 0; i < count; i++)
+        Write(appender, "message " + std::to_string(i));
+
+    appender.Flush();
+
+    const auto numbers = Numbers(ReadLines(path), "message ");
+    return numbers.size() + appender.GetDropped() == count && std::is_sorted(numbers.begin(), numbers.end()) &&
+        std::adjacent_find(numbers.begin(), numbers.end()) == numbers.end();
+
+}
+
+bool LoggingTester::TestReopen() {
+
+    const auto first = directory / "first.log";
+    const auto second = directory / "second.log";
+
+    {
+
+        AsyncAppender appender(first);
+        for(int i = 0; i < 100; i++)
+            Write(appender, "first " + std::to_string(i));
+
+        appender.Reopen(second);
+        for(int i = 0; i < 100; i++)
+            Write(appender, "second " + std::to_string(i));
+
+    } // the destructor writes what is left
+
+    const auto one = ReadLines(first);
+    const auto two = ReadLines(second);
+    return Numbers(one, "first ").size() == 100 && Numbers(one, "second ").empty() &&
+        Numbers(two, "second ").size() == 100 && Numbers(two, "first ").empty();
+
+}
+
+bool LoggingTester::TestInitLogging() {
+
+    const auto first = directory / "init.log";
+    const auto second = directory / "again.log";
+    const auto third = directory / "last.log";
+
+    SoundCath::InitLogging(first, plog::info);
+    LOGI("{} Info Goes to the First File\n", TAG);
+    LOGD("{} Debug is Filtered Out\n", TAG);
+
+    SoundCath::InitLogging(second, plog::debug); // writes what the first file has queued
+    LOGD("{} Debug Goes to the Second File\n", TAG);
+
+    SoundCath::InitLogging(third, plog::info);
+
+    const auto contains = [](const std::vector<std::string>& lines, const std::string& text) {
+        return std::any_of(lines.begin(), lines.end(), [&text](const std::string& line) { return line.find(text) != std::string::npos; });
+    };
+
+    const auto one = ReadLines(first);
+    const auto two = ReadLines(second);
+    return contains(one, "Info Goes to the First File") && !contains(one, "Debug is Filtered Out") &&
+        !contains(one, "Debug Goes to the Second File") && contains(two, "Debug Goes to the Second File");
+
+}
@@ -0,0 +1,78 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "Logging.hpp"
+
+#include <filesystem>
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the Asynchronous File Appender and the Logging Setup Behind the LOG Macros
+     * 
+     */
+    class LoggingTester {
+
+    public:
+
+        /**
+         * \brief Construct a new Logging Tester object, Makes a Fresh Directory for the Log Files
+         * 
+         */
+        LoggingTester();
+
+        /**
+         * \brief Destroy the Logging Tester object, Removes the Log Files
+         * 
+         */
+        ~LoggingTester();
+
+        /**
+         * \brief Tests that Every Line Written Ends Up in the File in Order
+         * \test Writes a Few Hundred Records, Flushes and Reads the File Back
+         * \return true: If Every Line is There in Order and None Were Dropped
+         * \return false: If a Line is Missing or Out of Order
+         */
+        bool TestWrite();
+
+        /**
+         * \brief Tests that a Full Queue Drops Lines and Counts Them Instead of Waiting
+         * \test Writes Thousands of Records Through a Queue of Two, Every Line Has to be Written or Counted as Dropped
+         * \return true: If the Written and Dropped Lines Add Up and the Written Ones are in Order
+         * \return false: If a Line Went Missing Without Being Counted
+         */
+        bool TestDropped();
+
+        /**
+         * \brief Tests that Reopening Writes What Was Queued to the Old File and the Rest to the New One
+         * \test Writes to One File, Reopens Another, Writes Again and Lets the Destructor Write the Rest
+         * \return true: If Each File Only Has its Own Lines
+         * \return false: If a Line Went to the Wrong File or Was Lost
+         */
+        bool TestReopen();
+
+        /**
+         * \brief Tests that Setting Up Logging Again Moves the Log and Changes the Severity
+         * \test Logs at Info to One File, Sets Up Debug on Another and Logs Debug, Then Moves Again so it is Written
+         * \return true: If the Messages are in Their Own Files
+         * \return false: If the Second Path or Severity Was Ignored
+         */
+        bool TestInitLogging();
+
+    private:
+
+        std::filesystem::path directory;    ///< Where the Log Files Go
+
+    };
+
+}
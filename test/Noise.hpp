@@ -0,0 +1,40 @@
+/**
+ * \file Noise.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief The Random Lines the Kernel Tests Compare Against Their Plain Loops
+ * \version 0.1
+ * \date 2022-05-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <random>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace SoundCath {
+
+/// Samples per Line in the Kernel Tests, Not a Whole Number of Vectors so the Tail Runs Too
+inline constexpr size_t ODD_SAMPLES = 203;
+
+/**
+ * \brief Makes Uniform Noise Between -1 and 1, the Same Every Time for a Seed
+ *
+ * \param[in] count: How Many Samples
+ * \param[in] random: Where the Noise Comes From, Shared so Later Draws Carry on From Here
+ * \return std::vector<float>: The Noise
+ */
+inline std::vector<float> MakeNoise(const size_t count, std::mt19937& random) {
+
+    std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+    std::vector<float> samples(count);
+    std::generate(samples.begin(), samples.end(), [&] { return noise(random); });
+    return samples;
+
+}
+
+}
@@ -0,0 +1,88 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-21
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+
+using SoundCath::SchedulerTester;
+using SoundCath::Scheduler;
+using SoundCath::Simulator;
+
+/// Keeps the Backoffs Short so the Tests Don't Wait Around
+static Scheduler::Config FastConfig() {
+
+    Scheduler::Config config;
+    config.retries = 4;
+    config.minbackoff = std::chrono::microseconds(1);
+    config.maxbackoff = std::chrono::microseconds(100);
+    return config;
+
+}
+
+SchedulerTester::SchedulerTester(): box(nullptr), face(MakeBox(box)) {}
+
+bool SchedulerTester::TestBusyRetry() {
+
+    Scheduler scheduler(face, FastConfig());
+
+    box->InjectErrors(1);
+    const uint64_t before = box->GetCommandCount();
+    if(!scheduler.TrySend("FireSingleElement:0,1"))
+        return false;
+
+    // the failure, the status read, then the one that went through, which also eases the backoff off
+    return box->GetCommandCount() - before == 3 && scheduler.GetRetries(Scheduler::ASIC_BUSY) == 1 &&
+        scheduler.GetRetries(Scheduler::FPGA_OVERFULL) == 0 && scheduler.GetGiveUps() == 0 &&
+        scheduler.GetBackoff(Scheduler::ASIC_BUSY) == std::chrono::microseconds(0);
+
+}
+
+bool SchedulerTester::TestOverfull() {
+
+    Scheduler scheduler(face, FastConfig());
+
+    Simulator::Config& config = box->GetConfig();
+    const Simulator::Config original = config;
+    config.drivererror = SoundCath::DriverError::FPGAERROR;
+    config.asicerror = 0;
+    config.fpgaerror = SoundCath::FPGAError::OVERFULL;
+
+    box->InjectErrors(1);
+    const bool sent = scheduler.TrySend("BmodeClearEntries").HasValue();
+    config = original;
+
+    return sent && scheduler.GetRetries(Scheduler::FPGA_OVERFULL) == 1 && scheduler.GetRetries(Scheduler::ASIC_BUSY) == 0;
+
+}
+
+bool SchedulerTester::TestGiveUp() {
+
+    Scheduler scheduler(face, FastConfig());
+
+    Simulator::Config& config = box->GetConfig();
+    const Simulator::Config original = config;
+    config.asicerror = SoundCath::ASICError::CHKSUM_ERROR;
+
+    box->InjectErrors(1);
+    const auto fatal = scheduler.TrySend("FireSingleElement:0,1");
+    config = original;
+
+    if(fatal || scheduler.GetRetries(Scheduler::ASIC_BUSY) != 0)
+        return false;
+
+    config.errorrate = 1.0; // every fire fails, the status reads still go through
+    config.errorprefix = "FireSingleElement";
+    const auto busy = scheduler.TrySend("FireSingleElement:0,1");
+    config = original;
+
+    return !busy && busy.GetError() == SoundCath::DriverError::ASICERROR && scheduler.GetGiveUps() == 1 &&
+        scheduler.GetRetries(Scheduler::ASIC_BUSY) == 4 && scheduler.TrySend("FireSingleElement:0,1").HasValue();
+
+}
@@ -0,0 +1,64 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-21
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "Scheduler.hpp"
+#include "../Box.hpp"
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the Command Scheduler Against the Simulated USX Box
+     * 
+     */
+    class SchedulerTester {
+
+    public:
+
+        /**
+         * \brief Construct a new Scheduler Tester object, the Driver Runs on a Simulator
+         * 
+         */
+        SchedulerTester();
+
+        /**
+         * \brief Tests that a Command Hitting a Busy ASIC is Retried Until it Goes Through
+         * \test Fails the Next Two Commands With BUSY, the Send Should Still Succeed After Two Retries
+         * \return true: If the Test Passes
+         * \return false: If the Send Failed or the Counters are Wrong
+         */
+        bool TestBusyRetry();
+
+        /**
+         * \brief Tests that a Full FPGA Queue is Counted Under its Own Cause
+         * \test Fails a Command With the FPGA Reporting OVERFULL and Checks Which Counter Moved
+         * \return true: If the Test Passes
+         * \return false: If the Send Failed or the Wrong Counter Moved
+         */
+        bool TestOverfull();
+
+        /**
+         * \brief Tests that Errors That Aren't Transient are Handed Back and Retries Run Out
+         * \test Fails a Command With a Checksum Error, Then Keeps the ASIC Busy Past the Retry Limit
+         * \return true: If the Test Passes
+         * \return false: If a Fatal Error was Retried or the Give Up Wasn't Counted
+         */
+        bool TestGiveUp();
+
+    private:
+
+        SoundCath::Simulator* box;  ///< The Simulated Box, Owned by the Driver
+        SoundCath::Driver face;     ///< The Interface the Scheduler Sends Through
+
+    };
+
+}
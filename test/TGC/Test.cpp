@@ -0,0 +1,116 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-28
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+using SoundCath::TGCTester;
+using SoundCath::TGC;
+using SoundCath::USParams;
+using SoundCath::BeamformedFrame;
+using SoundCath::ODD_SAMPLES;
+using SoundCath::MakeNoise;
+
+/// The Round Trip Gain at a Depth, the Slow Way
+static double Expected(const USParams& params, const double z_mm) noexcept {
+
+    return std::pow(10.0, 2.0 * params.attenuation * params.freq_cent_mhz * z_mm / 10.0 / 20.0);
+
+}
+
+bool TGCTester::TestGains() {
+
+    USParams params;
+    params.trparams.soundspeed = 1500.0;
+
+    TGC tgc(params, 750e3); // a mm of depth per sample
+    const std::vector<float>& gains = tgc.GetGains(101);
+
+    for(const size_t n: { 0, 50, 100 })
+        if(std::abs(gains[n] / Expected(params, double(n)) - 1.0) > 1e-5)
+            return false;
+
+    // the same depths at four times the rate are four times as many samples in
+    TGC faster(params, 3e6);
+    const std::vector<float>& fine = faster.GetGains(401);
+    for(const size_t n: { 0, 50, 100 })
+        if(std::abs(fine[4 * n] / gains[n] - 1.0) > 1e-5)
+            return false;
+
+    // 5 dB per cm there and back, 30 dB is reached at 6 cm
+    TGC capped(params, 750e3, 30.0f);
+    const std::vector<float>& limited = capped.GetGains(101);
+
+    return std::abs(limited[40] / Expected(params, 40.0) - 1.0) < 1e-5 && std::abs(limited[100] - std::pow(10.0, 1.5)) < 1e-3;
+
+}
+
+bool TGCTester::TestLazy() {
+
+    USParams params;
+    TGC tgc(params, 40e6);
+    std::vector<float> line(2500, 1.0f);
+
+    if(tgc.GetBuilds() != 0)
+        return false;
+
+    tgc.Apply(line.data(), line.size());
+    tgc.Apply(line.data(), line.size());
+
+    params.conparams.z_max_mm = 100.0;  // not used by the table
+    tgc.SetParams(params);
+    tgc.Apply(line.data(), line.size());
+
+    if(tgc.GetBuilds() != 1)
+        return false;
+
+    params.attenuation = 1.0f;
+    tgc.SetParams(params);
+    tgc.Apply(line.data(), line.size());
+    tgc.Apply(line.data(), 1000);
+
+    params.trparams.soundspeed = 1540.0;
+    tgc.SetParams(params);
+    tgc.Apply(line.data(), 1000);
+    tgc.Apply(line.data(), 1000);
+
+    return tgc.GetBuilds() == 4;
+
+}
+
+bool TGCTester::TestApply() {
+
+    TGC tgc(USParams{}, 40e6);
+
+    std::mt19937 random(5);
+
+    BeamformedFrame frame;
+    frame.lines = 7;
+    frame.samples = ODD_SAMPLES;
+    frame.data = MakeNoise(frame.lines * frame.samples, random);
+
+    const std::vector<float> original = frame.data;
+
+    ThreadPool pool(3);
+    tgc.Apply(frame, pool);
+
+    const std::vector<float>& gains = tgc.GetGains(frame.samples);
+    for(size_t line = 0; line < frame.lines; line++)
+        for(size_t n = 0; n < frame.samples; n++)
+            if(frame.GetLine(line)[n] != original[line * frame.samples + n] * gains[n])
+                return false;
+
+    return tgc.GetBuilds() == 1;
+
+}
@@ -0,0 +1,53 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-28
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "TGC.hpp"
+#include "../Noise.hpp"
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the Time Gain Compensation Stage
+     * 
+     */
+    class TGCTester {
+
+    public:
+
+        /**
+         * \brief Tests the Gain Table Against the Attenuation
+         * \test Builds the Table at Two Sample Rates and Checks the Gain at the Same Depths, Then Under a Low Cap
+         * \return true: If Every Gain is the Round Trip Attenuation at its Depth, or the Cap
+         * \return false: If a Gain is Off
+         */
+        bool TestGains();
+
+        /**
+         * \brief Tests That the Table is Only Rebuilt When it Has to be
+         * \test Compensates Lines While Changing Parameters the Table Does and Doesn't Use, and the Line Length
+         * \return true: If it was Rebuilt Exactly When Something it Uses Changed
+         * \return false: If it was Rebuilt Too Often or Not Enough
+         */
+        bool TestLazy();
+
+        /**
+         * \brief Tests a Block of Lines Over a Thread Pool Against a Plain Multiply
+         * \test Compensates Noise Lines, Not a Whole Number of Vectors Long, as a Beamformed Frame
+         * \return true: If Every Sample is the Noise Times its Gain
+         * \return false: If a Sample Differs
+         */
+        bool TestApply();
+
+    };
+
+}
@@ -0,0 +1,136 @@
+/**
+ * \file Test.cpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-18
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "Test.hpp"
+
+#include <cmath>
+#include <vector>
+
+using SoundCath::TelemetryTester;
+using SoundCath::Telemetry;
+using SoundCath::Simulator;
+using SoundCath::ASIC;
+using SoundCath::ASICParams;
+using SoundCath::ASICError;
+using SoundCath::GroupDelays;
+using SoundCath::Delays;
+
+/// Gives Every Command a Round Trip Like the Real Box, so the Poller and the Tests Overlap
+static Simulator::Config SlowLink() {
+
+    Simulator::Config config;
+    config.latency = std::chrono::microseconds(200);
+    return config;
+
+}
+
+TelemetryTester::TelemetryTester(): box(nullptr), face(MakeBox(box, SlowLink())) {}
+
+bool TelemetryTester::TestPoll() {
+
+    Telemetry telemetry(face, std::chrono::milliseconds(1));
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while(!telemetry.GetPolls() && std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    const Telemetry::Health health = telemetry.GetHealth();
+    return health.valid && std::abs(health.bandgap_v - 1.12) < 1e-9 && std::abs(health.temperature_v - 0.70) < 1e-9 &&
+        health.asicerror == 0 && health.fpgaerror == 0;
+
+}
+
+bool TelemetryTester::TestIdleOnly() {
+
+    Telemetry telemetry(face, std::chrono::milliseconds(1));
+
+    std::vector<std::future<std::string>> responses;
+    for(size_t i = 0; i < 2 * SoundCath::Driver::QUEUE_DEPTH; i++) // the queue stays busy for a few ms
+        responses.push_back(face.SendAsync("FireSingleElement:0," + std::to_string(i % 16)));
+
+    for(auto& response: responses)
+        if(response.get() != "FireSingleElement:RESULT: OK")
+            return false;
+
+    return telemetry.GetDeferred() > 0;
+
+}
+
+bool TelemetryTester::TestStatusBits() {
+
+    box->GetConfig().fpgaerror = 0x80010200;
+    box->InjectErrors(1);
+
+    try {
+        face.Send("FireSingleElement:0,0"); // fails and latches the status
+    }
+    catch(const std::exception&) {}
+
+    Telemetry telemetry(face, std::chrono::milliseconds(1));
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while(!telemetry.GetPolls() && std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    const Telemetry::Health health = telemetry.GetHealth();
+    return health.valid && uint32_t(health.fpgaerror) == 0x80010200 && health.asicerror == ASICError::BUSY;
+
+}
+
+bool TelemetryTester::TestReadbackWhilePolling() {
+
+    ASIC<ASICParams{}> asic(face);
+
+    GroupDelays tx{}, rx{}, phases{};
+    for(size_t i = 0; i < rx.size(); i++) {
+        rx[i] = int8_t(i * 2);
+        phases[i] = int8_t(i % 8);
+    }
+
+    constexpr SoundCath::Group group = 9;
+    asic.FireGroup(group, tx, rx, phases);
+
+    // with no latency a read holds the lock for a few microseconds, so the poller keeps landing right after one
+    const auto latency = box->GetConfig().latency;
+    box->GetConfig().latency = std::chrono::nanoseconds(0);
+
+    bool matched = true;
+    size_t reads = 0;
+    uint64_t polled = 0;
+
+    {
+        Telemetry telemetry(face, std::chrono::milliseconds(1));
+        const uint64_t before = box->GetCommandCount();
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        // keep reading until the poller has got 50 commands in between the reads
+        try {
+
+            while(matched && polled < 50 && std::chrono::steady_clock::now() < timeout) {
+
+                Delays delays, readphases;
+                asic.ReadRXDelays(delays, readphases);
+                polled = box->GetCommandCount() - before - ++reads;
+
+                for(size_t i = 0; i < rx.size(); i++)
+                    matched &= delays[group * 16 + i] == rx[i] && readphases[group * 16 + i] == phases[i];
+
+            }
+        }
+        catch(const std::exception&) { // a poll's response didn't parse as delays
+            matched = false;
+        }
+    }
+
+    box->GetConfig().latency = latency;
+    return matched && polled >= 50;
+
+}
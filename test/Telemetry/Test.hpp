@@ -0,0 +1,72 @@
+/**
+ * \file Test.hpp
+ * \author Orion Serup (orionserup@gmail.com)
+ * \brief 
+ * \version 0.1
+ * \date 2022-05-18
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#pragma once
+
+#include "Telemetry.hpp"
+#include "../Box.hpp"
+
+namespace SoundCath {
+
+    /**
+     * \brief Tests the Telemetry Poller Against the Simulated USX Box
+     * 
+     */
+    class TelemetryTester {
+
+    public:
+
+        /**
+         * \brief Construct a new Telemetry Tester object, the Driver Runs on a Simulator With a Little Latency
+         * 
+         */
+        TelemetryTester();
+
+        /**
+         * \brief Tests that the Readings Show Up in the Snapshot
+         * \test Waits for a Poll and Checks the Values Against What the Simulator Reports
+         * \return true: If the Test Passes
+         * \return false: If Nothing was Published or the Values are Wrong
+         */
+        bool TestPoll();
+
+        /**
+         * \brief Tests that Polls Wait for the Driver to be Idle
+         * \test Keeps the Queue Busy With Asynchronous Commands, Polls Should be Put Off and Every Command Should Complete
+         * \return true: If the Test Passes
+         * \return false: If No Poll was Put Off or a Command Failed
+         */
+        bool TestIdleOnly();
+
+        /**
+         * \brief Tests that Every Bit of the Status Makes it Into the Snapshot
+         * \test Latches an FPGA Status With Bit 31 Set and a BUSY ASIC, Then Waits for a Poll
+         * \return true: If the Snapshot has the Whole 32 Bit FPGA Status and the ASIC Status
+         * \return false: If Any Bit was Dropped
+         */
+        bool TestStatusBits();
+
+        /**
+         * \brief Tests that Polls Don't Overwrite a Response Before it is Parsed
+         * \test Reads the RX Delays Back Over and Over While Polling Every Millisecond
+         * \return true: If Every Read Matches What was Fired and Poll Commands Went Out in Between
+         * \return false: If a Read Came Back Wrong, Which Means a Poll's Response Got Parsed as the Delays
+         */
+        bool TestReadbackWhilePolling();
+
+    private:
+
+        SoundCath::Simulator* box;  ///< The Simulated Box, Owned by the Driver
+        SoundCath::Driver face;     ///< The Interface the Telemetry Polls Through
+
+    };
+
+}
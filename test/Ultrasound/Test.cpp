@@ -9,4 +9,59 @@
  * 
  */
 
-#include "Test.hpp"
\ No newline at end of file
+#include "Test.hpp"
+#include "Exception.hpp"
+
+#include <memory>
+
+using SoundCath::UltrasoundTester;
+using SoundCath::USParams;
+
+template<USParams params>
+UltrasoundTester<params>::UltrasoundTester(): box(nullptr), us(MakeBox(box)) {}
+
+template<USParams params>
+bool UltrasoundTester<params>::TestSetParams() {
+
+    const size_t keys = us.GetShadow().Size();
+    uint64_t before = box->GetCommandCount();
+    us.SetParams(params);
+
+    if(box->GetCommandCount() != before || us.GetShadow().Size() != keys)
+        return false;
+
+    USParams changed = params;
+    changed.asicparams.core.ResCal = uint8_t((params.asicparams.core.ResCal + 1) % 8);
+
+    before = box->GetCommandCount();
+    us.SetParams(changed);
+
+    const std::string* value = us.GetShadow().Get("ConfigCore", "ResCal");
+    return box->GetCommandCount() == before + 1 && value && *value == fmt::format("{}", changed.asicparams.core.ResCal);
+
+}
+
+template<USParams params>
+bool UltrasoundTester<params>::TestSetParamsError() {
+
+    USParams changed = params;
+    changed.asicparams.core.ResCal = uint8_t((params.asicparams.core.ResCal + 1) % 8);
+    us.SetParams(params);
+
+    box->InjectErrors(1);
+    bool threw = false;
+    try {
+        us.SetParams(changed);
+    }
+    catch(const SoundCath::DriverException&) {
+        threw = true;
+    }
+
+    if(!threw || us.GetShadow().Get("ConfigCore", "ResCal"))
+        return false;
+
+    const uint64_t before = box->GetCommandCount();
+    us.SetParams(changed);
+    return box->GetCommandCount() == before + 1 && us.GetShadow().Get("ConfigCore", "ResCal");
+
+}
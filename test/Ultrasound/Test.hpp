@@ -12,20 +12,47 @@
 #pragma once
 
 #include "Ultrasound.hpp"
+#include "../Box.hpp"
 
 namespace SoundCath {
 
+/**
+ * \brief Tests the Ultrasound Against the Simulated USX Box, so it Runs Without Hardware
+ * 
+ * \tparam params: The Parameters the Ultrasound is Constructed With
+ */
 template<USParams params>
 class UltrasoundTester {
 public:
 
-
+    /**
+     * \brief Construct a new Ultrasound Tester object, the Ultrasound Runs on a Default Simulator
+     * 
+     */
+    UltrasoundTester();
+
+    /**
+     * \brief Tests that Applying Parameters Only Sends What Changed
+     * \test Applies the Construction Params Again, Then Changes One Setting and Checks Only That Key is Sent and the Box Has it
+     * \return true: If the Test Passes
+     * \return false: If Unchanged Parameters Were Sent or the Change Didn't Reach the Box
+     */
+    bool TestSetParams();
+
+    /**
+     * \brief Tests that a Rejected Parameter is Sent Again Next Time
+     * \test Fails the Next SetParam on the Box, Then Applies the Same Params Again
+     * \return true: If the Test Passes
+     * \return false: If the Failure Didn't Throw or the Parameter Wasn't Retried
+     */
+    bool TestSetParamsError();
 
 private:
 
-    UltraSound<params> us; ///< The Ultrasound to Test
+    Simulator* box;         ///< The Simulated Box, Owned by the Driver
+    UltraSound<params> us;  ///< The Ultrasound to Test
 
 };
 
 
-}
\ No newline at end of file
+}